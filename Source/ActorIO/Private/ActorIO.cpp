@@ -5,11 +5,13 @@
 #include "ActorIOAction.h"
 #include "ActorIOInterface.h"
 #include "ActorIOSubsystemBase.h"
+#include "ActorIOVersions.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Level.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "UObject/UObjectIterator.h"
+#include "UObject/UnrealType.h"
 
 DEFINE_LOG_CATEGORY(LogActorIO);
 
@@ -33,6 +35,22 @@ TAutoConsoleVariable<bool> CVarLogIOActionFinalCommand(
     TEXT("ActorIO.LogFinalCommand"), false,
     TEXT("<bool> Log the final command sent to the target actor after executing I/O action."), ECVF_Default);
 
+TAutoConsoleVariable<bool> CVarCacheGlobalNamedArgs(
+    TEXT("ActorIO.CacheGlobalNamedArgs"), false,
+    TEXT("<bool> Compute global named arguments at most once per frame, and share them between every action executed in that frame. Only enable this if no override of GetGlobalNamedArguments depends on the action being executed."), ECVF_Default);
+
+TAutoConsoleVariable<bool> CVarTypedObjectArgs(
+    TEXT("ActorIO.TypedObjectArgs"), true,
+    TEXT("<bool> Pass object named arguments (e.g. $Actor, $Player) to object parameters as pointers, instead of converting them to paths."), ECVF_Default);
+
+TAutoConsoleVariable<bool> CVarFastArgumentImport(
+    TEXT("ActorIO.FastArgumentImport"), true,
+    TEXT("<bool> Import arguments of common parameter types (e.g. bool, int, float, name, string, enum, vector) with specialized importers instead of the generic property text importer."), ECVF_Default);
+
+TAutoConsoleVariable<bool> CVarClusterIOComponents(
+    TEXT("ActorIO.ClusterComponents"), false,
+    TEXT("<bool> Create garbage collection clusters for I/O components and their actions when they are loaded with their level. Actions removed at runtime stay in memory until the level is unloaded. Measure with the ActorIOBenchmark commandlet (Clusters variant) before enabling."), ECVF_Default);
+
 //==================================
 //~ Begin FActionExecutionContext
 //==================================
@@ -49,6 +67,7 @@ void FActionExecutionContext::EnterContext(UActorIOAction* InAction, void* InScr
     ActionPtr = InAction;
     ScriptParams = InScriptParams;
     NamedArguments.Reset();
+    ObjectArguments.Reset();
     bAborted = false;
     bProcessResult = false;
 }
@@ -65,22 +84,34 @@ bool FActionExecutionContext::HasContext() const
     return ActionPtr.Get() != nullptr;
 }
 
-void FActionExecutionContext::SetNamedArgument(const FString& InName, const FString& InValue)
+bool FActionExecutionContext::IsValidArgumentName(const FString& InName)
 {
-    if (HasContext() && !InName.IsEmpty())
+    if (InName.IsEmpty())
     {
-        if (!InName.StartsWith(NAMEDARGUMENT_PREFIX))
-        {
-            UE_LOG(LogActorIO, Error, TEXT("ActionExecutionContext: Attempted to set named argument without the required '%s' prefix. Name was: %s"), NAMEDARGUMENT_PREFIX, *InName);
-            return;
-        }
+        return false;
+    }
 
-        int32 InvalidCharIndex = INDEX_NONE;
-        if (InName.FindChar('"', InvalidCharIndex) || InName.FindChar(';', InvalidCharIndex))
-        {
-            UE_LOG(LogActorIO, Error, TEXT("ActionExecutionContext: Attempted to set named argument with illegal character. Name was: %s"), *InName);
-            return;
-        }
+    if (!InName.StartsWith(NAMEDARGUMENT_PREFIX))
+    {
+        UE_LOG(LogActorIO, Error, TEXT("ActionExecutionContext: Attempted to set named argument without the required '%s' prefix. Name was: %s"), NAMEDARGUMENT_PREFIX, *InName);
+        return false;
+    }
+
+    int32 InvalidCharIndex = INDEX_NONE;
+    if (InName.FindChar('"', InvalidCharIndex) || InName.FindChar(';', InvalidCharIndex))
+    {
+        UE_LOG(LogActorIO, Error, TEXT("ActionExecutionContext: Attempted to set named argument with illegal character. Name was: %s"), *InName);
+        return false;
+    }
+
+    return true;
+}
+
+void FActionExecutionContext::SetNamedArgument(const FString& InName, const FString& InValue)
+{
+    if (HasContext() && IsValidArgumentName(InName))
+    {
+        ObjectArguments.Remove(InName);
 
         if (!InValue.IsEmpty())
         {
@@ -94,6 +125,29 @@ void FActionExecutionContext::SetNamedArgument(const FString& InName, const FStr
     }
 }
 
+void FActionExecutionContext::SetObjectArgument(const FString& InName, UObject* InObject)
+{
+    if (!CVarTypedObjectArgs.GetValueOnGameThread())
+    {
+        SetNamedArgument(InName, IsValid(InObject) ? InObject->GetPathName() : FString());
+        return;
+    }
+
+    if (HasContext() && IsValidArgumentName(InName))
+    {
+        NamedArguments.Remove(InName);
+
+        if (IsValid(InObject))
+        {
+            ObjectArguments.FindOrAdd(InName) = InObject;
+        }
+        else
+        {
+            ObjectArguments.Remove(InName);
+        }
+    }
+}
+
 void FActionExecutionContext::AbortAction()
 {
     if (HasContext())
@@ -102,10 +156,196 @@ void FActionExecutionContext::AbortAction()
     }
 }
 
+//==================================
+//~ Begin FActorIOEventBinding
+//==================================
+
+bool FActorIOEventBinding::Resolve(const FActorIOEvent& InEvent, bool bEvenIfPendingKill)
+{
+    *this = FActorIOEventBinding();
+
+    UObject* InDelegateOwner = InEvent.DelegateOwner.Get(bEvenIfPendingKill);
+    if (!InDelegateOwner || (!bEvenIfPendingKill && !IsValid(InDelegateOwner)))
+    {
+        return false;
+    }
+
+    DelegateOwner = InDelegateOwner;
+    DelegateType = InEvent.DelegateType;
+
+    switch (InEvent.DelegateType)
+    {
+        // Multicast delegates are referenced directly by the I/O event.
+        case FActorIOEvent::Type::MulticastDelegate:
+        {
+            MulticastDelegatePtr = InEvent.MulticastDelegatePtr;
+            break;
+        }
+
+        // Sparse delegates are stored in a global storage so we need to resolve them first.
+        case FActorIOEvent::Type::SparseDelegate:
+        {
+            SparseDelegatePtr = FSparseDelegateStorage::ResolveSparseDelegate(DelegateOwner, InEvent.SparseDelegateName);
+            SparseDelegateName = InEvent.SparseDelegateName;
+            break;
+        }
+
+        // Blueprint exposed dynamic delegates (e.g. event dispatchers) are found by property name.
+        case FActorIOEvent::Type::BlueprintDelegate:
+        {
+            UClass* DelegateOwnerClass = DelegateOwner->GetClass();
+            DelegatePropertyPtr = CastField<FMulticastDelegateProperty>(DelegateOwnerClass->FindPropertyByName(InEvent.BlueprintDelegateName));
+            break;
+        }
+
+        case FActorIOEvent::Type::Null:
+        {
+            break;
+        }
+    }
+
+    return IsResolved();
+}
+
+bool FActorIOEventBinding::IsResolved() const
+{
+    if (!DelegateOwner)
+    {
+        return false;
+    }
+
+    switch (DelegateType)
+    {
+        case FActorIOEvent::Type::MulticastDelegate: return MulticastDelegatePtr != nullptr;
+        case FActorIOEvent::Type::SparseDelegate: return SparseDelegatePtr != nullptr;
+        case FActorIOEvent::Type::BlueprintDelegate: return DelegatePropertyPtr != nullptr;
+        default: return false;
+    }
+}
+
+void FActorIOEventBinding::AddDelegate(const FScriptDelegate& InDelegate) const
+{
+    check(IsResolved());
+
+    switch (DelegateType)
+    {
+        case FActorIOEvent::Type::MulticastDelegate:
+        {
+            MulticastDelegatePtr->Add(InDelegate);
+            break;
+        }
+
+        // We have to use the interal add function because there's no other way to set the bIsBound param for it.
+        // If the bIsBound param is not set, the delegate will not execute.
+        case FActorIOEvent::Type::SparseDelegate:
+        {
+            SparseDelegatePtr->__Internal_AddUnique(DelegateOwner, SparseDelegateName, InDelegate);
+            break;
+        }
+
+        case FActorIOEvent::Type::BlueprintDelegate:
+        {
+            DelegatePropertyPtr->AddDelegate(InDelegate, DelegateOwner);
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+}
+
+void FActorIOEventBinding::RemoveDelegate(const FScriptDelegate& InDelegate) const
+{
+    check(IsResolved());
+
+    switch (DelegateType)
+    {
+        case FActorIOEvent::Type::MulticastDelegate:
+        {
+            MulticastDelegatePtr->Remove(InDelegate);
+            break;
+        }
+
+        case FActorIOEvent::Type::SparseDelegate:
+        {
+            SparseDelegatePtr->__Internal_Remove(DelegateOwner, SparseDelegateName, InDelegate);
+            break;
+        }
+
+        case FActorIOEvent::Type::BlueprintDelegate:
+        {
+            DelegatePropertyPtr->RemoveDelegate(InDelegate, DelegateOwner);
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+}
+
+FString FActorIOEventBinding::GetResolveErrorReason(const FActorIOEvent& InEvent, bool bEvenIfPendingKill)
+{
+    UObject* InDelegateOwner = InEvent.DelegateOwner.Get(bEvenIfPendingKill);
+    if (!InDelegateOwner || (!bEvenIfPendingKill && !IsValid(InDelegateOwner)))
+    {
+        return TEXT("Delegate owner was invalid.");
+    }
+
+    switch (InEvent.DelegateType)
+    {
+        case FActorIOEvent::Type::MulticastDelegate: return TEXT("Delegate reference was nullptr.");
+        case FActorIOEvent::Type::SparseDelegate: return FString::Printf(TEXT("Failed to resolve sparse delegate with name '%s'."), *InEvent.SparseDelegateName.ToString());
+        case FActorIOEvent::Type::BlueprintDelegate: return FString::Printf(TEXT("No event dispatcher found with name '%s'."), *InEvent.BlueprintDelegateName.ToString());
+        default: return TEXT("Delegate type was null! Forgot to set a delegate?");
+    }
+}
+
 //==================================
 //~ Begin FActorIOMessage
 //==================================
 
+FString FActorIOMessage::ResolveObjectArguments(const FString& InArguments, const TArray<TWeakObjectPtr<UObject>>& InObjects)
+{
+    const TCHAR PrefixChar = OBJECTARGUMENT_PREFIX[0];
+
+    int32 PrefixIndex = INDEX_NONE;
+    if (!InArguments.FindChar(PrefixChar, PrefixIndex))
+    {
+        return InArguments;
+    }
+
+    FString OutArguments;
+    OutArguments.Reserve(InArguments.Len() + InObjects.Num() * 64);
+
+    const TCHAR* Str = *InArguments;
+    while (*Str)
+    {
+        if (*Str != PrefixChar)
+        {
+            OutArguments.AppendChar(*Str++);
+            continue;
+        }
+
+        // Placeholder is the prefix followed by the index of the object slot.
+        ++Str;
+        int32 SlotIdx = 0;
+        while (FChar::IsDigit(*Str))
+        {
+            SlotIdx = SlotIdx * 10 + (*Str++ - TEXT('0'));
+        }
+
+        // Objects that were destroyed since the message was sent are passed as none, same as a null object property.
+        const UObject* Object = InObjects.IsValidIndex(SlotIdx) ? InObjects[SlotIdx].Get() : nullptr;
+        OutArguments.Append(Object ? Object->GetPathName() : FString(TEXT("None")));
+    }
+
+    return OutArguments;
+}
+
 void FActorIOMessage::SerializeMessage(FStructuredArchive::FRecord Record)
 {
     FArchive& UnderlyingArchive = Record.GetUnderlyingArchive();
@@ -125,7 +365,16 @@ void FActorIOMessage::SerializeMessage(FStructuredArchive::FRecord Record)
     Record << SA_VALUE(TEXT("Sender"), SenderPath);
     Record << SA_VALUE(TEXT("Target"), TargetPath);
     Record << SA_VALUE(TEXT("FunctionId"), FunctionId);
-    Record << SA_VALUE(TEXT("Arguments"), Arguments);
+    if (UnderlyingArchive.IsSaving() && ObjectArguments.Num() > 0)
+    {
+        // Typed object arguments are saved as paths, same as any other argument.
+        FString ResolvedArguments = GetResolvedArguments();
+        Record << SA_VALUE(TEXT("Arguments"), ResolvedArguments);
+    }
+    else
+    {
+        Record << SA_VALUE(TEXT("Arguments"), Arguments);
+    }
     Record << SA_VALUE(TEXT("MessageFlags"), MessageFlags);
     Record << SA_VALUE(TEXT("TimeRemaining"), TimeRemaining);
 
@@ -136,6 +385,214 @@ void FActorIOMessage::SerializeMessage(FStructuredArchive::FRecord Record)
     }
 }
 
+bool FActorIOMessage::SerializeCompactMessages(FArchive& Ar, TArray<FActorIOMessage>& Messages, int32 Version)
+{
+    // Layout:
+    //   [packed] NumStrings, followed by the strings
+    //   [packed] NumSenderIds, followed by the sender ids (MessageSenderIds and above)
+    //   [packed] NumMessages, followed by the messages
+    //   Message: [packed] SenderAsset, SenderSubPath, TargetAsset, TargetSubPath, FunctionId, Arguments (string indices)
+    //            [packed] SenderId (sender id index, MessageSenderIds and above)
+    //            [float] TimeRemaining
+    //            [uint8] MessageFlags
+    // String index zero is always the empty string, and sender id index zero is always the invalid id.
+
+    const bool bHasSenderIds = Version >= FActorIOSubsystemVersion::MessageSenderIds;
+
+    TArray<FString> StringTable;
+    TArray<FGuid> SenderIdTable;
+
+    if (Ar.IsSaving())
+    {
+        TMap<FString, uint32> StringIndices;
+        TMap<FTopLevelAssetPath, uint32> AssetIndices;
+        TMap<FGuid, uint32> SenderIdIndices;
+
+        StringTable.Add(FString());
+        StringIndices.Add(FString(), 0);
+
+        SenderIdTable.Add(FGuid());
+        SenderIdIndices.Add(FGuid(), 0);
+
+        auto AddString = [&StringTable, &StringIndices](const FString& InString) -> uint32
+        {
+            if (const uint32* ExistingIndex = StringIndices.Find(InString))
+            {
+                return *ExistingIndex;
+            }
+
+            const uint32 NewIndex = StringTable.Add(InString);
+            StringIndices.Add(InString, NewIndex);
+            return NewIndex;
+        };
+
+        // Asset paths are the only part that can have a PIE prefix.
+        // Removing the prefix once per unique asset, instead of once per message.
+        auto AddAssetPath = [&AssetIndices, &AddString](const FTopLevelAssetPath& InAssetPath) -> uint32
+        {
+            if (const uint32* ExistingIndex = AssetIndices.Find(InAssetPath))
+            {
+                return *ExistingIndex;
+            }
+
+            const uint32 NewIndex = InAssetPath.IsNull() ? 0 : AddString(UWorld::RemovePIEPrefix(InAssetPath.ToString()));
+            AssetIndices.Add(InAssetPath, NewIndex);
+            return NewIndex;
+        };
+
+        auto AddSenderId = [&SenderIdTable, &SenderIdIndices](const FGuid& InSenderId) -> uint32
+        {
+            if (const uint32* ExistingIndex = SenderIdIndices.Find(InSenderId))
+            {
+                return *ExistingIndex;
+            }
+
+            const uint32 NewIndex = SenderIdTable.Add(InSenderId);
+            SenderIdIndices.Add(InSenderId, NewIndex);
+            return NewIndex;
+        };
+
+        TArray<uint32> MessageIndices;
+        MessageIndices.Reserve(Messages.Num() * 7);
+
+        for (const FActorIOMessage& Message : Messages)
+        {
+            const FSoftObjectPath& SenderPath = Message.SenderPtr.ToSoftObjectPath();
+            const FSoftObjectPath& TargetPath = Message.TargetPtr.ToSoftObjectPath();
+
+            MessageIndices.Add(AddAssetPath(SenderPath.GetAssetPath()));
+            MessageIndices.Add(AddString(SenderPath.GetSubPathString()));
+            MessageIndices.Add(AddAssetPath(TargetPath.GetAssetPath()));
+            MessageIndices.Add(AddString(TargetPath.GetSubPathString()));
+            MessageIndices.Add(AddString(Message.FunctionId.ToString()));
+            MessageIndices.Add(AddString(Message.ObjectArguments.Num() > 0 ? Message.GetResolvedArguments() : Message.Arguments));
+            MessageIndices.Add(AddSenderId(Message.SenderId));
+        }
+
+        uint32 NumStrings = StringTable.Num();
+        Ar.SerializeIntPacked(NumStrings);
+        for (FString& String : StringTable)
+        {
+            Ar << String;
+        }
+
+        if (bHasSenderIds)
+        {
+            uint32 NumSenderIds = SenderIdTable.Num();
+            Ar.SerializeIntPacked(NumSenderIds);
+            for (FGuid& SenderId : SenderIdTable)
+            {
+                Ar << SenderId;
+            }
+        }
+
+        const int32 NumFields = bHasSenderIds ? 7 : 6;
+
+        uint32 NumMessages = Messages.Num();
+        Ar.SerializeIntPacked(NumMessages);
+        for (int32 MessageIdx = 0; MessageIdx != Messages.Num(); ++MessageIdx)
+        {
+            for (int32 FieldIdx = 0; FieldIdx != NumFields; ++FieldIdx)
+            {
+                Ar.SerializeIntPacked(MessageIndices[MessageIdx * 7 + FieldIdx]);
+            }
+
+            // Runtime only flags are not saved.
+            float TimeRemaining = Messages[MessageIdx].TimeRemaining;
+            uint8 Flags = Messages[MessageIdx].MessageFlags & ~static_cast<uint8>(EMessageFlags::IsProcessed);
+            Ar << TimeRemaining;
+            Ar << Flags;
+        }
+    }
+    else if (Ar.IsLoading())
+    {
+        uint32 NumStrings = 0;
+        Ar.SerializeIntPacked(NumStrings);
+        if (Ar.IsError() || NumStrings == 0 || NumStrings > static_cast<uint32>(Ar.TotalSize()))
+        {
+            return false;
+        }
+
+        StringTable.SetNum(NumStrings);
+        for (FString& String : StringTable)
+        {
+            Ar << String;
+        }
+
+        SenderIdTable.Add(FGuid());
+        if (bHasSenderIds)
+        {
+            uint32 NumSenderIds = 0;
+            Ar.SerializeIntPacked(NumSenderIds);
+            if (Ar.IsError() || NumSenderIds == 0 || NumSenderIds > static_cast<uint32>(Ar.TotalSize()))
+            {
+                return false;
+            }
+
+            SenderIdTable.SetNum(NumSenderIds);
+            for (FGuid& SenderId : SenderIdTable)
+            {
+                Ar << SenderId;
+            }
+        }
+
+        uint32 NumMessages = 0;
+        Ar.SerializeIntPacked(NumMessages);
+        if (Ar.IsError() || NumMessages > static_cast<uint32>(Ar.TotalSize()))
+        {
+            return false;
+        }
+
+        Messages.Reset(NumMessages);
+        for (uint32 MessageIdx = 0; MessageIdx != NumMessages; ++MessageIdx)
+        {
+            uint32 Indices[6];
+            for (uint32& Index : Indices)
+            {
+                Ar.SerializeIntPacked(Index);
+                if (Index >= NumStrings)
+                {
+                    return false;
+                }
+            }
+
+            uint32 SenderIdIndex = 0;
+            if (bHasSenderIds)
+            {
+                Ar.SerializeIntPacked(SenderIdIndex);
+                if (SenderIdIndex >= static_cast<uint32>(SenderIdTable.Num()))
+                {
+                    return false;
+                }
+            }
+
+            FActorIOMessage& Message = Messages.AddDefaulted_GetRef();
+            Ar << Message.TimeRemaining;
+            Ar << Message.MessageFlags;
+
+            FSoftObjectPath SenderPath;
+            if (!StringTable[Indices[0]].IsEmpty())
+            {
+                SenderPath.SetPath(FTopLevelAssetPath(StringTable[Indices[0]]), StringTable[Indices[1]]);
+            }
+
+            FSoftObjectPath TargetPath;
+            if (!StringTable[Indices[2]].IsEmpty())
+            {
+                TargetPath.SetPath(FTopLevelAssetPath(StringTable[Indices[2]]), StringTable[Indices[3]]);
+            }
+
+            Message.SenderPtr = SenderPath;
+            Message.SenderId = SenderIdTable[SenderIdIndex];
+            Message.TargetPtr = TargetPath;
+            Message.FunctionId = FName(*StringTable[Indices[4]]);
+            Message.Arguments = StringTable[Indices[5]];
+        }
+    }
+
+    return !Ar.IsError();
+}
+
 //==================================
 //~ Begin IActorIO
 //==================================
@@ -149,6 +606,7 @@ FActorIOEventList IActorIO::GetEventsForObject(AActor* InObject)
     FActorIOEventList OutEvents = FActorIOEventList();
     if (IsValid(InObject))
     {
+        UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(InObject);
         if (InObject->Implements<UActorIOInterface>())
         {
             IActorIOInterface* IOInterface = Cast<IActorIOInterface>(InObject);
@@ -157,10 +615,13 @@ FActorIOEventList IActorIO::GetEventsForObject(AActor* InObject)
                 IOInterface->RegisterIOEvents(OutEvents);
             }
 
-            IActorIOInterface::Execute_K2_RegisterIOEvents(InObject, OutEvents);
+            // Blueprint registrations captured in the class registry do not need to run the blueprint function.
+            if (!IOSubsystem || !IOSubsystem->RegisterStaticEventsForObject(InObject, OutEvents))
+            {
+                IActorIOInterface::Execute_K2_RegisterIOEvents(InObject, OutEvents);
+            }
         }
 
-        UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(InObject);
         if (IOSubsystem)
         {
             IOSubsystem->RegisterNativeEventsForObject(InObject, OutEvents);
@@ -180,6 +641,7 @@ FActorIOFunctionList IActorIO::GetFunctionsForObject(AActor* InObject)
     FActorIOFunctionList OutFunctions = FActorIOFunctionList();
     if (IsValid(InObject))
     {
+        UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(InObject);
         if (InObject->Implements<UActorIOInterface>())
         {
             IActorIOInterface* IOInterface = Cast<IActorIOInterface>(InObject);
@@ -188,10 +650,13 @@ FActorIOFunctionList IActorIO::GetFunctionsForObject(AActor* InObject)
                 IOInterface->RegisterIOFunctions(OutFunctions);
             }
 
-            IActorIOInterface::Execute_K2_RegisterIOFunctions(InObject, OutFunctions);
+            // Blueprint registrations captured in the class registry do not need to run the blueprint function.
+            if (!IOSubsystem || !IOSubsystem->RegisterStaticFunctionsForObject(InObject, OutFunctions))
+            {
+                IActorIOInterface::Execute_K2_RegisterIOFunctions(InObject, OutFunctions);
+            }
         }
 
-        UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(InObject);
         if (IOSubsystem)
         {
             IOSubsystem->RegisterNativeFunctionsForObject(InObject, OutFunctions);
@@ -211,6 +676,47 @@ const TArray<TWeakObjectPtr<UActorIOAction>> IActorIO::GetInputActionsForObject(
     TArray<TWeakObjectPtr<UActorIOAction>> OutActions = TArray<TWeakObjectPtr<UActorIOAction>>();
     if (IsValid(InObject))
     {
+        // Game worlds keep a registry of bound actions, so there is no need to iterate every action object.
+        // Actions are not bound in editor worlds, so those still have to be found the slow way.
+        UWorld* World = InObject->GetWorld();
+        UActorIOSubsystemBase* IOSubsystem = World && World->IsGameWorld() ? UActorIOSubsystemBase::Get(InObject) : nullptr;
+        if (IOSubsystem)
+        {
+            IOSubsystem->GetActionRegistry().GetActionsTargeting(InObject, OutActions);
+
+            // The registry only has bound actions. Actions that are not bound (e.g. their component is waiting for time sliced binding,
+            // or their event could not be found) are still found through their components, which are far fewer than the action objects.
+            // Plain data actions of cooked levels that have no object yet are also found here, and their object is created since it was asked for.
+            const FActorIOActionRegistry& ActionRegistry = IOSubsystem->GetActionRegistry();
+            for (TObjectIterator<UActorIOComponent> ComponentItr; ComponentItr; ++ComponentItr)
+            {
+                UActorIOComponent* IOComponent = *ComponentItr;
+                if (!IsValid(IOComponent) || IOComponent->GetWorld() != World)
+                {
+                    continue;
+                }
+
+                for (int32 ActionIdx = 0; ActionIdx != IOComponent->GetNumActions(); ++ActionIdx)
+                {
+                    UActorIOAction* Action = IOComponent->GetActions()[ActionIdx].Get();
+                    if (!Action)
+                    {
+                        const FActorIOActionData* Data = IOComponent->GetActionData(ActionIdx);
+                        if (Data && Data->TargetActor.Get() == InObject)
+                        {
+                            OutActions.Emplace(IOComponent->GetOrCreateAction(ActionIdx));
+                        }
+                    }
+                    else if (IsValid(Action) && ActionRegistry.GetDenseIndex(Action->GetRegistryHandle()) == INDEX_NONE && Action->TargetActor.Get() == InObject)
+                    {
+                        OutActions.Emplace(Action);
+                    }
+                }
+            }
+
+            return OutActions;
+        }
+
         for (TObjectIterator<UActorIOAction> ActionItr; ActionItr; ++ActionItr)
         {
             UActorIOAction* Action = *ActionItr;
@@ -249,10 +755,11 @@ const TArray<TWeakObjectPtr<UActorIOAction>> IActorIO::GetOutputActionsForObject
         UActorIOComponent* IOComponent = InObject->GetComponentByClass<UActorIOComponent>();
         if (IOComponent)
         {
-            for (const TObjectPtr<UActorIOAction>& Action : IOComponent->GetActions())
+            for (int32 ActionIdx = 0; ActionIdx != IOComponent->GetNumActions(); ++ActionIdx)
             {
+                // Plain data actions of cooked levels only get their object when asked for.
                 // Convert to weak ptr so that we cannot modify action's lifetime in editor.
-                OutActions.Emplace(Action);
+                OutActions.Emplace(IOComponent->GetOrCreateAction(ActionIdx));
             }
         }
     }
@@ -4,6 +4,7 @@
 #include "ActorIOComponent.h"
 #include "ActorIOInterface.h"
 #include "ActorIOSubsystemBase.h"
+#include "LogicActors/LogicRelay.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
 
@@ -17,12 +18,85 @@ UActorIOAction::UActorIOAction()
 	FunctionArguments = FString();
 	Delay = 0.0f;
 	bExecuteOnlyOnce = false;
+#if WITH_EDITORONLY_DATA
+	bKeepWhenCooking = false;
+#endif
 
+	ActionId = FGuid();
 	bWasExecuted = false;
 	bIsBound = false;
 	ActionDelegate = FScriptDelegate();
+	BoundEventProcessor = FScriptDelegate();
+	BoundDelegateOwner = nullptr;
+	ArgumentTokens = TArray<FString>();
+	bHasArgumentTokens = false;
+	bDirectRelayTrigger = false;
+	RegistryHandle = FActorIOActionHandle();
+#if WITH_EDITORONLY_DATA
+	bStrippedFromCook = false;
+#endif
 }
 
+void UActorIOAction::AssignNewActionId()
+{
+	ActionId = FGuid::NewGuid();
+}
+
+void UActorIOAction::PostLoad()
+{
+	Super::PostLoad();
+
+	// Actions saved before ids were introduced get an id based on their path.
+	// This is the same in every session, so save data referring to the id stays valid until the level is resaved with a real id.
+	if (!ActionId.IsValid() && !HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		ActionId = FGuid::NewDeterministicGuid(UWorld::RemovePIEPrefix(GetPathName()));
+	}
+}
+
+void UActorIOAction::PostDuplicate(EDuplicateMode::Type DuplicateMode)
+{
+	Super::PostDuplicate(DuplicateMode);
+
+	// Duplicated actions are new actions, except when the level is duplicated for PIE.
+	if (DuplicateMode != EDuplicateMode::PIE && ActionId.IsValid())
+	{
+		AssignNewActionId();
+	}
+}
+
+bool UActorIOAction::IsEditorOnly() const
+{
+#if WITH_EDITORONLY_DATA
+	if (bStrippedFromCook)
+	{
+		return true;
+	}
+#endif
+
+	return Super::IsEditorOnly();
+}
+
+#if WITH_EDITOR
+void UActorIOAction::PostEditImport()
+{
+	Super::PostEditImport();
+
+	// Pasted actions are new actions.
+	AssignNewActionId();
+}
+
+void UActorIOAction::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UActorIOAction, FunctionArguments))
+	{
+		bHasArgumentTokens = false;
+	}
+}
+#endif
+
 void UActorIOAction::BindAction()
 {
 	AActor* ActionOwner = GetOwnerActor();
@@ -42,72 +116,39 @@ void UActorIOAction::BindAction()
 		return;
 	}
 
-	UObject* DelegateOwner = TargetEvent->DelegateOwner.Get();
-	if (!IsValid(DelegateOwner))
+	FActorIOEventBinding EventBinding;
+	EventBinding.Resolve(*TargetEvent);
+	BindAction(*TargetEvent, EventBinding);
+}
+
+void UActorIOAction::BindAction(const FActorIOEvent& TargetEvent, const FActorIOEventBinding& EventBinding)
+{
+	AActor* ActionOwner = GetOwnerActor();
+	check(ActionOwner);
+
+	if (bIsBound)
 	{
-		UE_CLOG(DebugIOActions, LogActorIO, Error, TEXT("Actor '%s' could not bind action to '%s' - Delegate owner was invalid."), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString());
+		UE_CLOG(DebugIOActions, LogActorIO, Error, TEXT("Actor '%s' could not bind action to '%s' - Action is already bound!"), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString());
 		return;
 	}
 
-	ActionDelegate = FScriptDelegate();
-	ActionDelegate.BindUFunction(this, NAME_ExecuteAction);
-
-	switch (TargetEvent->DelegateType)
+	if (!EventBinding.IsResolved())
 	{
-		// Binding to multicast delegate directly.
-		// Since we have a direct reference to the delegate, we can simply add to it.
-		case FActorIOEvent::Type::MulticastDelegate:
-		{
-			if (TargetEvent->MulticastDelegatePtr)
-			{
-				TargetEvent->MulticastDelegatePtr->Add(ActionDelegate);
-				bIsBound = true;
-			}
+		UE_CLOG(DebugIOActions, LogActorIO, Error, TEXT("Actor '%s' could not bind action to '%s' - %s"), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString(), *FActorIOEventBinding::GetResolveErrorReason(TargetEvent));
+		return;
+	}
 
-			UE_CLOG(DebugIOActions && !bIsBound, LogActorIO, Error, TEXT("Actor '%s' could not bind action to '%s' - Delegate reference was nullptr."), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString());
-			break;
-		}
-		
-		// Binding to a sparse delegate.
-		// These delegates are stored in a global storage so we need to resolve it first.
-		// Then we have to use the interal add function because there's no other way to set the bIsBound param for it.
-		// If the bIsBound param is not set, the delegate will not execute.
-		case FActorIOEvent::Type::SparseDelegate:
-		{
-			FSparseDelegate* SparseDelegate = FSparseDelegateStorage::ResolveSparseDelegate(DelegateOwner, TargetEvent->SparseDelegateName);
-			if (SparseDelegate)
-			{
-				SparseDelegate->__Internal_AddUnique(DelegateOwner, TargetEvent->SparseDelegateName, ActionDelegate);
-				bIsBound = true;
-			}
+	ActionDelegate = FScriptDelegate();
+	ActionDelegate.BindUFunction(this, NAME_ExecuteAction);
 
-			UE_CLOG(DebugIOActions && !bIsBound, LogActorIO, Error, TEXT("Actor '%s' could not bind action to '%s' - Failed to resolve sparse delegate with name '%s'."), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString(), *TargetEvent->SparseDelegateName.ToString());
-			break;
-		}
-		
-		// Binding to a blueprint exposed dynamic delegate.
-		// These include event dispatchers created in blueprints.
-		// Each event dispatcher is basically just an FMulticastDelegateProperty that we can add to.
-		case FActorIOEvent::Type::BlueprintDelegate:
-		{
-			UClass* DelegateOwnerClass = DelegateOwner->GetClass();
-			FMulticastDelegateProperty* DelegateProp = CastField<FMulticastDelegateProperty>(DelegateOwnerClass->FindPropertyByName(TargetEvent->BlueprintDelegateName));
-			if (DelegateProp)
-			{
-				DelegateProp->AddDelegate(ActionDelegate, DelegateOwner);
-				bIsBound = true;
-			}
+	EventBinding.AddDelegate(ActionDelegate);
+	bIsBound = true;
 
-			UE_CLOG(DebugIOActions && !bIsBound, LogActorIO, Error, TEXT("Actor '%s' could not bind action to '%s' - No event dispatcher found with name '%s'."), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString(), *TargetEvent->BlueprintDelegateName.ToString());
-			break;
-		}
+	// Store the event processor so that we do not need to look up the I/O event every time the action is executed.
+	BoundEventProcessor = TargetEvent.EventProcessor;
+	BoundDelegateOwner = EventBinding.DelegateOwner;
 
-		case FActorIOEvent::Type::Null:
-		{
-			UE_CLOG(DebugIOActions, LogActorIO, Error, TEXT("Actor '%s' could not bind action to '%s' - Delegate type was null! Forgot to set a delegate?"), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString());
-			break;
-		}
-	}
+	AddToActionRegistry();
 }
 
 void UActorIOAction::UnbindAction()
@@ -120,13 +161,7 @@ void UActorIOAction::UnbindAction()
 		return;
 	}
 
-	UActorIOComponent* OwnerIOComponent = GetOwnerIOComponent();
-	if (!OwnerIOComponent)
-	{
-		return;
-	}
-
-	const FActorIOEventList ValidEvents = IActorIO::GetEventsForObject(OwnerIOComponent->GetOwner());
+	const FActorIOEventList ValidEvents = IActorIO::GetEventsForObject(ActionOwner);
 	const FActorIOEvent* TargetEvent = ValidEvents.GetEvent(EventId);
 	if (!TargetEvent)
 	{
@@ -134,64 +169,55 @@ void UActorIOAction::UnbindAction()
 		// Basically the I/O event that the action is bound to was not found.
 		// Only case when this can happen is if your register IO events function does not always return the same list of events.
 		checkf(false, TEXT("Could not unbind action because the I/O event that we were bound to was not found?!"));
+		return;
 	}
 
-	UObject* DelegateOwner = TargetEvent->DelegateOwner.Get(true);
-	if (!DelegateOwner)
+	FActorIOEventBinding EventBinding;
+	EventBinding.Resolve(*TargetEvent, true);
+	UnbindAction(*TargetEvent, EventBinding);
+}
+
+void UActorIOAction::UnbindAction(const FActorIOEvent& TargetEvent, const FActorIOEventBinding& EventBinding)
+{
+	AActor* ActionOwner = GetOwnerActor();
+	check(ActionOwner);
+
+	if (!bIsBound)
 	{
-		UE_CLOG(DebugIOActions, LogActorIO, Error, TEXT("Actor '%s' could not unbind action from '%s' - Delegate owner was nullptr."), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString());
 		return;
 	}
 
-	switch (TargetEvent->DelegateType)
-	{
-		case FActorIOEvent::Type::MulticastDelegate:
-		{
-			FMulticastScriptDelegate* TargetDelegate = TargetEvent->MulticastDelegatePtr;
-			if (TargetDelegate)
-			{
-				TargetDelegate->Remove(ActionDelegate);
-				bIsBound = false;
-			}
+	// This should be impossible to reach.
+	// Implies that the action was bound to an I/O event successfully before, but now the event reverted to null type.
+	checkf(TargetEvent.DelegateType != FActorIOEvent::Type::Null, TEXT("Could not unbind action because the I/O event delegate type is null?!"));
 
-			UE_CLOG(DebugIOActions && bIsBound, LogActorIO, Error, TEXT("Actor '%s' could not unbind action from '%s' - Delegate reference was nullptr."), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString());
-			break;
-		}
+	if (!EventBinding.IsResolved())
+	{
+		UE_CLOG(DebugIOActions, LogActorIO, Error, TEXT("Actor '%s' could not unbind action from '%s' - %s"), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString(), *FActorIOEventBinding::GetResolveErrorReason(TargetEvent, true));
+		return;
+	}
 
-		case FActorIOEvent::Type::SparseDelegate:
-		{
-			FSparseDelegate* SparseDelegate = FSparseDelegateStorage::ResolveSparseDelegate(DelegateOwner, TargetEvent->SparseDelegateName);
-			if (SparseDelegate)
-			{
-				SparseDelegate->__Internal_Remove(DelegateOwner, TargetEvent->SparseDelegateName, ActionDelegate);
-				bIsBound = false;
-			}
+	EventBinding.RemoveDelegate(ActionDelegate);
+	bIsBound = false;
+	BoundEventProcessor.Unbind();
+	BoundDelegateOwner.Reset();
 
-			UE_CLOG(DebugIOActions && bIsBound, LogActorIO, Error, TEXT("Actor '%s' could not unbind action from '%s' - Failed to resolve sparse delegate with name '%s'."), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString(), *TargetEvent->SparseDelegateName.ToString());
-			break;
-		}
+	RemoveFromActionRegistry();
+}
 
-		case FActorIOEvent::Type::BlueprintDelegate:
-		{
-			UClass* DelegateOwnerClass = DelegateOwner->GetClass();
-			FMulticastDelegateProperty* DelegateProp = CastField<FMulticastDelegateProperty>(DelegateOwnerClass->FindPropertyByName(TargetEvent->BlueprintDelegateName));
-			if (DelegateProp)
-			{
-				DelegateProp->RemoveDelegate(ActionDelegate, DelegateOwner);
-				bIsBound = false;
-			}
+void UActorIOAction::SetDispatchedBinding(const FScriptDelegate& InEventProcessor, UObject* InDelegateOwner)
+{
+	// The action is not bound on its own, its component forwards the I/O event instead.
+	BoundEventProcessor = InEventProcessor;
+	BoundDelegateOwner = InDelegateOwner;
 
-			UE_CLOG(DebugIOActions && bIsBound, LogActorIO, Error, TEXT("Actor '%s' could not unbind action from '%s' - No event dispatcher found with name '%s'."), *ActionOwner->GetActorNameOrLabel(), *EventId.ToString(), *TargetEvent->BlueprintDelegateName.ToString());
-			break;
-		}
+	AddToActionRegistry();
+}
 
-		case FActorIOEvent::Type::Null:
-		{
-			// This should be impossible to reach.
-			// Implies that the action was bound to an I/O event successfully before, but now the event reverted to null type.
-			checkf(false, TEXT("Could not unbind action because the I/O event delegate type is null?!"));
-		}
-	}
+void UActorIOAction::ExecuteFromDispatcher(void* Parms)
+{
+	// Go through ProcessEvent, so that the action is processed the same way as when its own delegate is called.
+	ProcessEvent(FindFunctionChecked(NAME_ExecuteAction), Parms);
 }
 
 void UActorIOAction::ProcessEvent(UFunction* Function, void* Parms)
@@ -258,7 +284,8 @@ bool UActorIOAction::ProcessAction(FActionExecutionContext& ExecutionContext)
 	{
 		// Let the I/O subsystem add globally available named arguments to the current execution context.
 		// Think stuff like reference to player character, or player controller.
-		IOSubsystem->GetGlobalNamedArguments(ExecutionContext);
+		// These are the same for every action, so they are only computed once per frame.
+		IOSubsystem->ApplyGlobalNamedArguments(ExecutionContext);
 
 		// Let the owning actor add locally available named arguments to the current execution context.
 		if (ActionOwnerIOInterface)
@@ -268,26 +295,26 @@ bool UActorIOAction::ProcessAction(FActionExecutionContext& ExecutionContext)
 		}
 	}
 
-	FActorIOEventList ValidEvents = IActorIO::GetEventsForObject(ActionOwner);
-	FActorIOEvent* BoundEvent = ValidEvents.GetEvent(EventId);
-	check(BoundEvent);
-
-	// Run the event processor.
+	// Run the event processor that was stored when binding the action.
 	// We are calling the event processor with the original params memory that we received from the delegate.
 	// This way the event processor will receive the proper values for its params given that its signature matches the delegate.
-	if (BoundEvent->EventProcessor.IsBound())
+	if (BoundEventProcessor.IsBound())
 	{
-		BoundEvent->EventProcessor.ProcessDelegate<UObject>(ExecutionContext.ScriptParams);
+		BoundEventProcessor.ProcessDelegate<UObject>(ExecutionContext.ScriptParams);
 	}
 
 	// Log named arguments to console for debugging if needed.
 	if (LogIONamedArgs)
 	{
-		UE_LOG(LogActorIO, Log, TEXT("  Named Arguments: (%d)"), ExecutionContext.NamedArguments.Num());
+		UE_LOG(LogActorIO, Log, TEXT("  Named Arguments: (%d)"), ExecutionContext.NamedArguments.Num() + ExecutionContext.ObjectArguments.Num());
 		for (const TPair<FString, FString>& NamedArg : ExecutionContext.NamedArguments)
 		{
 			UE_LOG(LogActorIO, Log, TEXT("  - %s = %s"), *NamedArg.Key, *NamedArg.Value);
 		}
+		for (const TPair<FString, TWeakObjectPtr<UObject>>& ObjectArg : ExecutionContext.ObjectArguments)
+		{
+			UE_LOG(LogActorIO, Log, TEXT("  - %s = %s"), *ObjectArg.Key, *GetPathNameSafe(ObjectArg.Value.Get()));
+		}
 	}
 
 	// Give the owning actor a chance to abort action execution (if it wasn't aborted already by the event processor).
@@ -303,25 +330,121 @@ bool UActorIOAction::ProcessAction(FActionExecutionContext& ExecutionContext)
 	return !ExecutionContext.bAborted;
 }
 
-void UActorIOAction::ExecuteAction()
+void UActorIOAction::AddToActionRegistry()
 {
-	FActionExecutionContext& ExecutionContext = FActionExecutionContext::Get(this);
-	check(ExecutionContext.HasContext());
+	UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(this);
+	if (IOSubsystem && IOSubsystem->GetActionRegistry().GetDenseIndex(RegistryHandle) == INDEX_NONE)
+	{
+		RegistryHandle = IOSubsystem->GetActionRegistry().Add(this);
+	}
+}
 
-	// Early out if action was stopped or aborted.
-	if (!ExecutionContext.bProcessResult)
+void UActorIOAction::RemoveFromActionRegistry()
+{
+	if (!RegistryHandle.IsSet())
 	{
-		UE_CLOG(DebugIOActions && ExecutionContext.bAborted, LogActorIO, Log, TEXT("Action was aborted."));
-		ExecutionContext.ExitContext();
 		return;
 	}
 
+	UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(this);
+	if (IOSubsystem)
+	{
+		IOSubsystem->GetActionRegistry().Remove(RegistryHandle);
+	}
+
+	RegistryHandle.Reset();
+}
+
+void UActorIOAction::CopyToActionData(FActorIOActionData& OutData) const
+{
+	OutData.ActionName = GetFName();
+	OutData.ActionId = ActionId;
+	OutData.EventId = EventId;
+	OutData.TargetActor = TargetActor;
+	OutData.FunctionId = FunctionId;
+	OutData.FunctionArguments = FunctionArguments;
+	OutData.Delay = Delay;
+	OutData.bExecuteOnlyOnce = bExecuteOnlyOnce;
+}
+
+void UActorIOAction::InitFromActionData(const FActorIOActionData& InData)
+{
+	ActionId = InData.ActionId;
+	EventId = InData.EventId;
+	TargetActor = InData.TargetActor;
+	FunctionId = InData.FunctionId;
+	FunctionArguments = InData.FunctionArguments;
+	Delay = InData.Delay;
+	bExecuteOnlyOnce = InData.bExecuteOnlyOnce;
+	bHasArgumentTokens = false;
+}
+
+void UActorIOAction::SetArgumentTokens(const TArray<FString>& InTokens)
+{
+	ArgumentTokens = InTokens;
+	bHasArgumentTokens = true;
+}
+
+bool UActorIOAction::CanTriggerRelayDirectly() const
+{
+	static const FName NAME_RelayTrigger = TEXT("ALogicRelay::Trigger");
+	if (FunctionId != NAME_RelayTrigger || Delay > 0.0f || !FunctionArguments.TrimStartAndEnd().IsEmpty())
+	{
+		return false;
+	}
+
+	// The relay must be in the same level, so that it is always loaded together with the action.
+	const ALogicRelay* TargetRelay = Cast<ALogicRelay>(TargetActor.Get());
+	const AActor* ActionOwner = GetOwnerActor();
+	return TargetRelay && ActionOwner && TargetRelay->GetLevel() == ActionOwner->GetLevel();
+}
+
+#if WITH_EDITOR
+bool UActorIOAction::CanBeStrippedFromCook(FString& OutReason) const
+{
+	if (bKeepWhenCooking)
+	{
+		return false;
+	}
+
+	if (EventId.IsNone())
+	{
+		OutReason = TEXT("no event selected");
+		return true;
+	}
+
+	if (FunctionId.IsNone())
+	{
+		OutReason = TEXT("no function selected");
+		return true;
+	}
+
+	if (TargetActor.IsNull())
+	{
+		OutReason = TEXT("no target actor selected");
+		return true;
+	}
+
+	// Only loaded targets can be checked. Targets in other levels may be unloaded while this level is cooked.
+	const AActor* TargetActorPtr = TargetActor.Get();
+	if (TargetActorPtr && TargetActorPtr->IsEditorOnly())
+	{
+		OutReason = FString::Printf(TEXT("target actor '%s' is editor only"), *TargetActorPtr->GetName());
+		return true;
+	}
+
+	return false;
+}
+#endif
+
+void UActorIOAction::TokenizeArguments(const FString& InArguments, TArray<FString>& OutTokens)
+{
 	// Break up the user defined arguments string from a single line into multiple elements.
 	// This is the text that was set by the user in the Actor I/O editor.
-	TArray<FString> Arguments;
-	if (FunctionArguments.ParseIntoArray(Arguments, ARGUMENT_SEPARATOR, true) > 0)
+	OutTokens.Reset();
+	if (InArguments.ParseIntoArray(OutTokens, ARGUMENT_SEPARATOR, true) > 0)
 	{
-		for (FString& Argument : Arguments)
+		for (FString& Argument : OutTokens)
 		{
 			// Remove all whitespaces unless they are between quotes.
 			// This is because the final command uses whitespace as the separator.
@@ -338,24 +461,70 @@ void UActorIOAction::ExecuteAction()
 					Argument.RemoveAt(CharIndex);
 				}
 			}
+		}
+	}
+}
 
-			// Replace named arguments with their actual values.
-			// Everything stays in string form until the very end when the final command is sent.
-			// Argument values will be parsed by UnrealScript.
-			if (Argument.StartsWith(NAMEDARGUMENT_PREFIX) && ExecutionContext.NamedArguments.Contains(Argument))
-			{
-				const FString NamedArgValue = ExecutionContext.NamedArguments[Argument];
-				Argument = NamedArgValue;
-			}
+void UActorIOAction::ExecuteAction()
+{
+	FActionExecutionContext& ExecutionContext = FActionExecutionContext::Get(this);
+	check(ExecutionContext.HasContext());
+
+	// Early out if action was stopped or aborted.
+	if (!ExecutionContext.bProcessResult)
+	{
+		UE_CLOG(DebugIOActions && ExecutionContext.bAborted, LogActorIO, Log, TEXT("Action was aborted."));
+		ExecutionContext.ExitContext();
+		return;
+	}
+
+	// Collapsed relay chain, let the subsystem trigger the relay without going through an I/O message.
+	// Still has to wait for the levels to be active, same as the message would.
+	if (bDirectRelayTrigger)
+	{
+		ALogicRelay* TargetRelay = Cast<ALogicRelay>(TargetActor.Get());
+		UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(this);
+		if (TargetRelay && IOSubsystem && IOSubsystem->IsLevelActive(TargetRelay->GetLevel()))
+		{
+			ExecutionContext.ExitContext();
+			bWasExecuted = true;
+			IOSubsystem->GetActionRegistry().SetExecuted(RegistryHandle, true);
+
+			UE_CLOG(DebugIOActions, LogActorIO, Log, TEXT("Triggering relay '%s' directly."), *TargetRelay->GetActorNameOrLabel());
+			IOSubsystem->ProcessDirectRelayTrigger(this, TargetRelay);
+			return;
 		}
 	}
 
-	// Merge the processed arguments back into a single string in UnrealScript command format.
+	// The arguments are only tokenized once, the tokens are reused for every execution.
+	if (!bHasArgumentTokens)
+	{
+		TokenizeArguments(FunctionArguments, ArgumentTokens);
+		bHasArgumentTokens = true;
+	}
+
+	// Replace named arguments with their actual values, and merge the arguments into a single string in UnrealScript command format.
+	// Everything stays in string form until the very end when the final command is sent.
+	// Argument values will be parsed by UnrealScript.
+	// Typed object arguments are not converted to paths. Instead a placeholder is added that refers to the object slot of the message.
 	FString ProcessedArgs;
-	for (const FString& Argument : Arguments)
+	TArray<TWeakObjectPtr<UObject>> ObjectArgs;
+	for (const FString& Argument : ArgumentTokens)
 	{
 		ProcessedArgs.Append(TEXT(" "));
-		ProcessedArgs.Append(Argument);
+
+		if (Argument.StartsWith(NAMEDARGUMENT_PREFIX))
+		{
+			if (const TWeakObjectPtr<UObject>* ObjectArgValue = ExecutionContext.ObjectArguments.Find(Argument))
+			{
+				ProcessedArgs.Append(OBJECTARGUMENT_PREFIX);
+				ProcessedArgs.AppendInt(ObjectArgs.Add(*ObjectArgValue));
+				continue;
+			}
+		}
+
+		const FString* NamedArgValue = Argument.StartsWith(NAMEDARGUMENT_PREFIX) ? ExecutionContext.NamedArguments.Find(Argument) : nullptr;
+		ProcessedArgs.Append(NamedArgValue ? *NamedArgValue : Argument);
 	}
 
 	uint8 MessageFlags = 0x00;
@@ -364,9 +533,11 @@ void UActorIOAction::ExecuteAction()
 
 	FActorIOMessage NewMessage;
 	NewMessage.SenderPtr = this;
+	NewMessage.SenderId = ActionId;
 	NewMessage.TargetPtr = TargetActor;
 	NewMessage.FunctionId = FunctionId;
 	NewMessage.Arguments = ProcessedArgs;
+	NewMessage.ObjectArguments = MoveTemp(ObjectArgs);
 	NewMessage.MessageFlags = MessageFlags;
 	NewMessage.TimeRemaining = Delay;
 
@@ -375,6 +546,7 @@ void UActorIOAction::ExecuteAction()
 	bWasExecuted = true;
 
 	UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(this);
+	IOSubsystem->GetActionRegistry().SetExecuted(RegistryHandle, true);
 	IOSubsystem->QueueMessage(NewMessage);
 }
 
@@ -420,7 +592,8 @@ UObject* UActorIOAction::ResolveTargetObject(const FActorIOFunction* TargetFunct
 		// Check if the I/O function wants to be executed on a subobject instead of the target actor.
 		if (TargetFunction && !TargetFunction->TargetSubobject.IsNone())
 		{
-			OutTarget = TargetActorPtr->GetDefaultSubobjectByName(TargetFunction->TargetSubobject);
+			UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(TargetActorPtr);
+			OutTarget = IOSubsystem ? IOSubsystem->FindTargetSubobject(TargetActorPtr, TargetFunction->TargetSubobject) : TargetActorPtr->GetDefaultSubobjectByName(TargetFunction->TargetSubobject);
 		}
 	}
 
@@ -465,6 +638,31 @@ bool UActorIOAction::ShouldSerializeToArchive(FArchive& Ar) const
 	return bWasExecuted || Ar.ArNoDelta;
 }
 
+void UActorIOAction::RestoreExecutedState(bool bExecuted)
+{
+	const bool bHasExecutedAlready = bWasExecuted;
+	bWasExecuted = bExecuted;
+
+	UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(this);
+	if (IOSubsystem)
+	{
+		IOSubsystem->GetActionRegistry().SetExecuted(RegistryHandle, bExecuted);
+	}
+
+	// We must recall the messages if:
+	//  - the restored state says the action has been executed in the past
+	//  - and this action should only ever be executed once
+	//  - and before the state was restored the action has already been executed
+	if ((bWasExecuted && bExecuteOnlyOnce) && bHasExecutedAlready)
+	{
+		UE_CLOG(DebugIOActions, LogActorIO, Log, TEXT("Recalling pending I/O messages from action: '%s'"), *GetPathName());
+
+		// Since levels *should* only be active after the level's state was restored from a save file
+		// all messages that were sent prematurely *should* still be in the pending messages list.
+		IOSubsystem->RemovePendingMessages(this);
+	}
+}
+
 void UActorIOAction::Serialize(FStructuredArchive::FRecord Record)
 {
 	FArchive& UnderlyingArchive = Record.GetUnderlyingArchive();
@@ -481,22 +679,7 @@ void UActorIOAction::Serialize(FStructuredArchive::FRecord Record)
 
 		if (UnderlyingArchive.IsLoading())
 		{
-			const bool bHasExecutedAlready = bWasExecuted;
-			bWasExecuted = bExecuted;
-
-			// We must recall the messages if:
-			//  - the restored state says the action has been executed in the past
-			//  - and this action should only ever be executed once
-			//  - and before the state was restored the action has already been executed
-			if ((bWasExecuted && bExecuteOnlyOnce) && bHasExecutedAlready)
-			{
-				UE_CLOG(DebugIOActions, LogActorIO, Log, TEXT("Recalling pending I/O messages from action: '%s'"), *GetPathName());
-
-				// Since levels *should* only be active after the level's state was restored from a save file
-				// all messages that were sent prematurely *should* still be in the pending messages list.
-				UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(this);
-				IOSubsystem->RemovePendingMessages(this);
-			}
+			RestoreExecutedState(bExecuted);
 		}
 	}
 	else
@@ -0,0 +1,192 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "ActorIOActionRegistry.h"
+#include "ActorIOAction.h"
+#include "GameFramework/Actor.h"
+
+FActorIOActionHandle FActorIOActionRegistry::Add(UActorIOAction* InAction)
+{
+	check(InAction);
+
+	int32 SlotIndex = INDEX_NONE;
+	if (FreeSlots.Num() > 0)
+	{
+		SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		SlotIndex = HandleSlots.AddDefaulted();
+	}
+
+	const int32 DenseIndex = Actions.Add(InAction);
+	Owners.AddDefaulted();
+	EventIds.AddDefaulted();
+	Targets.AddDefaulted();
+	FunctionIds.AddDefaulted();
+	Flags.AddDefaulted();
+	ExecutedStates.Add(false);
+	DenseToSlot.Add(SlotIndex);
+
+	HandleSlots[SlotIndex].DenseIndex = DenseIndex;
+	UpdateColumns(DenseIndex, InAction);
+
+	FActorIOActionHandle OutHandle;
+	OutHandle.SlotIndex = SlotIndex;
+	OutHandle.Serial = HandleSlots[SlotIndex].Serial;
+	return OutHandle;
+}
+
+bool FActorIOActionRegistry::Remove(const FActorIOActionHandle& InHandle)
+{
+	const int32 DenseIndex = GetDenseIndex(InHandle);
+	if (DenseIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Move the last action into the removed slot, so that the columns stay packed.
+	const int32 LastIndex = Actions.Num() - 1;
+	if (DenseIndex != LastIndex)
+	{
+		Actions[DenseIndex] = Actions[LastIndex];
+		Owners[DenseIndex] = Owners[LastIndex];
+		EventIds[DenseIndex] = EventIds[LastIndex];
+		Targets[DenseIndex] = Targets[LastIndex];
+		FunctionIds[DenseIndex] = FunctionIds[LastIndex];
+		Flags[DenseIndex] = Flags[LastIndex];
+		ExecutedStates[DenseIndex] = ExecutedStates[LastIndex];
+		DenseToSlot[DenseIndex] = DenseToSlot[LastIndex];
+		HandleSlots[DenseToSlot[DenseIndex]].DenseIndex = DenseIndex;
+	}
+
+	Actions.RemoveAt(LastIndex, EAllowShrinking::No);
+	Owners.RemoveAt(LastIndex, EAllowShrinking::No);
+	EventIds.RemoveAt(LastIndex, EAllowShrinking::No);
+	Targets.RemoveAt(LastIndex, EAllowShrinking::No);
+	FunctionIds.RemoveAt(LastIndex, EAllowShrinking::No);
+	Flags.RemoveAt(LastIndex, EAllowShrinking::No);
+	ExecutedStates.RemoveAt(LastIndex);
+	DenseToSlot.RemoveAt(LastIndex, EAllowShrinking::No);
+
+	FHandleSlot& Slot = HandleSlots[InHandle.SlotIndex];
+	Slot.DenseIndex = INDEX_NONE;
+	++Slot.Serial;
+	FreeSlots.Add(InHandle.SlotIndex);
+	return true;
+}
+
+void FActorIOActionRegistry::SetExecuted(const FActorIOActionHandle& InHandle, bool bExecuted)
+{
+	const int32 DenseIndex = GetDenseIndex(InHandle);
+	if (DenseIndex != INDEX_NONE)
+	{
+		ExecutedStates[DenseIndex] = bExecuted;
+	}
+}
+
+int32 FActorIOActionRegistry::GetDenseIndex(const FActorIOActionHandle& InHandle) const
+{
+	if (!HandleSlots.IsValidIndex(InHandle.SlotIndex))
+	{
+		return INDEX_NONE;
+	}
+
+	const FHandleSlot& Slot = HandleSlots[InHandle.SlotIndex];
+	return Slot.Serial == InHandle.Serial ? Slot.DenseIndex : INDEX_NONE;
+}
+
+void FActorIOActionRegistry::GetActionsTargeting(const AActor* InActor, TArray<TWeakObjectPtr<UActorIOAction>>& OutActions)
+{
+	const FObjectKey TargetKey = FObjectKey(InActor);
+	for (int32 Idx = 0; Idx != Targets.Num(); ++Idx)
+	{
+		if (Targets[Idx] == TargetKey)
+		{
+			OutActions.Add(Actions[Idx]);
+			continue;
+		}
+
+		// The target may have been streamed in since the action was registered,
+		// or it was streamed out and back in, in which case the key points to the old actor that no longer exists.
+		// Resolving the key is a cheap lookup in the object array, unlike resolving the soft pointer of the action.
+		if (!EnumHasAnyFlags(Flags[Idx], EActorIOActionRegistryFlags::TargetUnresolved) && Targets[Idx].ResolveObjectPtr())
+		{
+			continue;
+		}
+
+		const UActorIOAction* Action = Actions[Idx].Get();
+		const AActor* TargetActor = Action ? Action->TargetActor.Get() : nullptr;
+		if (!TargetActor)
+		{
+			EnumAddFlags(Flags[Idx], EActorIOActionRegistryFlags::TargetUnresolved);
+			continue;
+		}
+
+		Targets[Idx] = FObjectKey(TargetActor);
+		EnumRemoveFlags(Flags[Idx], EActorIOActionRegistryFlags::TargetUnresolved);
+
+		if (Targets[Idx] == TargetKey)
+		{
+			OutActions.Add(Actions[Idx]);
+		}
+	}
+}
+
+int32 FActorIOActionRegistry::GetNumExecuted() const
+{
+	return ExecutedStates.CountSetBits();
+}
+
+void FActorIOActionRegistry::Reset()
+{
+	// Keep the serials, so that handles from before the reset do not match new actions.
+	for (int32 SlotIdx = 0; SlotIdx != HandleSlots.Num(); ++SlotIdx)
+	{
+		FHandleSlot& Slot = HandleSlots[SlotIdx];
+		if (Slot.DenseIndex != INDEX_NONE)
+		{
+			Slot.DenseIndex = INDEX_NONE;
+			++Slot.Serial;
+			FreeSlots.Add(SlotIdx);
+		}
+	}
+
+	Actions.Reset();
+	Owners.Reset();
+	EventIds.Reset();
+	Targets.Reset();
+	FunctionIds.Reset();
+	Flags.Reset();
+	ExecutedStates.Reset();
+	DenseToSlot.Reset();
+}
+
+void FActorIOActionRegistry::UpdateColumns(int32 DenseIndex, UActorIOAction* InAction)
+{
+	const AActor* TargetActor = InAction->TargetActor.Get();
+
+	EActorIOActionRegistryFlags NewFlags = EActorIOActionRegistryFlags::None;
+	if (InAction->bExecuteOnlyOnce)
+	{
+		NewFlags |= EActorIOActionRegistryFlags::ExecuteOnlyOnce;
+	}
+	if (InAction->Delay > 0.0f)
+	{
+		NewFlags |= EActorIOActionRegistryFlags::Delayed;
+	}
+	if (InAction->IsDirectRelayTrigger())
+	{
+		NewFlags |= EActorIOActionRegistryFlags::DirectRelayTrigger;
+	}
+	if (!TargetActor && !InAction->TargetActor.IsNull())
+	{
+		NewFlags |= EActorIOActionRegistryFlags::TargetUnresolved;
+	}
+
+	Owners[DenseIndex] = FObjectKey(InAction->GetOwnerActor());
+	EventIds[DenseIndex] = InAction->EventId;
+	Targets[DenseIndex] = FObjectKey(TargetActor);
+	FunctionIds[DenseIndex] = InAction->FunctionId;
+	Flags[DenseIndex] = NewFlags;
+	ExecutedStates[DenseIndex] = InAction->GetWasExecuted();
+}
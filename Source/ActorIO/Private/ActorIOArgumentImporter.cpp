@@ -0,0 +1,372 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "ActorIOArgumentImporter.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
+
+namespace ActorIOArgumentImporter
+{
+	/**
+	 * Scan a decimal number at the start of the string.
+	 * @return Pointer past the number, or nullptr if the string does not start with a number.
+	 */
+	const TCHAR* ScanNumber(const TCHAR* Str, bool bAllowFraction)
+	{
+		const TCHAR* Cursor = Str;
+		if (*Cursor == TCHAR('-') || *Cursor == TCHAR('+'))
+		{
+			++Cursor;
+		}
+
+		const TCHAR* DigitsStart = Cursor;
+		while (FChar::IsDigit(*Cursor))
+		{
+			++Cursor;
+		}
+
+		bool bHasDigits = Cursor != DigitsStart;
+		if (bAllowFraction)
+		{
+			if (*Cursor == TCHAR('.'))
+			{
+				++Cursor;
+				const TCHAR* FractionStart = Cursor;
+				while (FChar::IsDigit(*Cursor))
+				{
+					++Cursor;
+				}
+
+				bHasDigits |= Cursor != FractionStart;
+			}
+
+			if (bHasDigits && (*Cursor == TCHAR('e') || *Cursor == TCHAR('E')))
+			{
+				++Cursor;
+				if (*Cursor == TCHAR('-') || *Cursor == TCHAR('+'))
+				{
+					++Cursor;
+				}
+
+				const TCHAR* ExponentStart = Cursor;
+				while (FChar::IsDigit(*Cursor))
+				{
+					++Cursor;
+				}
+
+				if (Cursor == ExponentStart)
+				{
+					return nullptr;
+				}
+			}
+		}
+
+		return bHasDigits ? Cursor : nullptr;
+	}
+
+	/**
+	 * Parse a floating point number that makes up the whole string.
+	 * @return Whether the string was a number.
+	 */
+	bool ParseFloatingPoint(const FString& Text, double& OutValue)
+	{
+		const TCHAR* End = ScanNumber(*Text, true);
+		if (!End || *End != TCHAR('\0'))
+		{
+			return false;
+		}
+
+		OutValue = FCString::Atod(*Text);
+		return true;
+	}
+
+	/**
+	 * Parse a struct in the form of "(Field1=Number,Field2=Number,...)".
+	 * Fields must be in the given order, and none of them can be missing.
+	 *
+	 * @return Whether the string was in the expected form.
+	 */
+	bool ParseNumericStruct(const FString& Text, const TCHAR* const* FieldNames, int32 NumFields, double* OutValues)
+	{
+		const TCHAR* Cursor = *Text;
+		if (*Cursor != TCHAR('('))
+		{
+			return false;
+		}
+
+		++Cursor;
+		for (int32 FieldIdx = 0; FieldIdx != NumFields; ++FieldIdx)
+		{
+			const int32 NameLen = FCString::Strlen(FieldNames[FieldIdx]);
+			if (FCString::Strnicmp(Cursor, FieldNames[FieldIdx], NameLen) != 0 || Cursor[NameLen] != TCHAR('='))
+			{
+				return false;
+			}
+
+			Cursor += NameLen + 1;
+			const TCHAR* NumberEnd = ScanNumber(Cursor, true);
+			if (!NumberEnd)
+			{
+				return false;
+			}
+
+			OutValues[FieldIdx] = FCString::Atod(Cursor);
+			Cursor = NumberEnd;
+
+			const TCHAR ExpectedDelimiter = FieldIdx == NumFields - 1 ? TCHAR(')') : TCHAR(',');
+			if (*Cursor != ExpectedDelimiter)
+			{
+				return false;
+			}
+
+			++Cursor;
+		}
+
+		return *Cursor == TCHAR('\0');
+	}
+
+	bool ImportBool(const FProperty* Property, FString& Text, void* Container)
+	{
+		bool bValue = false;
+		if (Text.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Text == TEXT("1"))
+		{
+			bValue = true;
+		}
+		else if (Text.Equals(TEXT("false"), ESearchCase::IgnoreCase) || Text == TEXT("0"))
+		{
+			bValue = false;
+		}
+		else
+		{
+			return false;
+		}
+
+		CastFieldChecked<const FBoolProperty>(Property)->SetPropertyValue_InContainer(Container, bValue);
+		return true;
+	}
+
+	bool ImportInt(const FProperty* Property, FString& Text, void* Container)
+	{
+		// Leave hex values and enum names to the generic importer.
+		// Numbers with more characters than the sign and digits of an int32 are left to it too, so that the value below can't overflow.
+		const TCHAR* End = ScanNumber(*Text, false);
+		if (!End || *End != TCHAR('\0') || Text.Len() > 11)
+		{
+			return false;
+		}
+
+		const TCHAR* Cursor = *Text;
+		const bool bNegative = *Cursor == TCHAR('-');
+		if (*Cursor == TCHAR('-') || *Cursor == TCHAR('+'))
+		{
+			++Cursor;
+		}
+
+		int64 Value = 0;
+		for (; *Cursor; ++Cursor)
+		{
+			Value = Value * 10 + (*Cursor - TCHAR('0'));
+		}
+
+		// Out of range values are left to the generic importer as well, instead of wrapping around.
+		Value = bNegative ? -Value : Value;
+		if (Value < MIN_int32 || Value > MAX_int32)
+		{
+			return false;
+		}
+
+		CastFieldChecked<const FIntProperty>(Property)->SetPropertyValue_InContainer(Container, static_cast<int32>(Value));
+		return true;
+	}
+
+	bool ImportFloat(const FProperty* Property, FString& Text, void* Container)
+	{
+		double Value = 0.0;
+		if (!ParseFloatingPoint(Text, Value))
+		{
+			return false;
+		}
+
+		CastFieldChecked<const FFloatProperty>(Property)->SetPropertyValue_InContainer(Container, static_cast<float>(Value));
+		return true;
+	}
+
+	bool ImportDouble(const FProperty* Property, FString& Text, void* Container)
+	{
+		double Value = 0.0;
+		if (!ParseFloatingPoint(Text, Value))
+		{
+			return false;
+		}
+
+		CastFieldChecked<const FDoubleProperty>(Property)->SetPropertyValue_InContainer(Container, Value);
+		return true;
+	}
+
+	bool ImportName(const FProperty* Property, FString& Text, void* Container)
+	{
+		// Only names that the generic importer would read as a single unquoted token.
+		if (Text.IsEmpty())
+		{
+			return false;
+		}
+
+		for (const TCHAR Char : Text)
+		{
+			const bool bTokenChar = FChar::IsAlnum(Char) || Char == TCHAR('_') || Char == TCHAR('-') || Char == TCHAR('+')
+				|| Char == TCHAR('.') || Char == TCHAR('/') || Char == SUBOBJECT_DELIMITER_CHAR;
+
+			if (!bTokenChar)
+			{
+				return false;
+			}
+		}
+
+		CastFieldChecked<const FNameProperty>(Property)->SetPropertyValue_InContainer(Container, FName(*Text));
+		return true;
+	}
+
+	bool ImportString(const FProperty* Property, FString& Text, void* Container)
+	{
+		// The argument is not needed anymore, so the string can be moved instead of copied.
+		*CastFieldChecked<const FStrProperty>(Property)->GetPropertyValuePtr_InContainer(Container) = MoveTemp(Text);
+		return true;
+	}
+
+	bool ImportByte(const FProperty* Property, FString& Text, void* Container)
+	{
+		// Only enum names are handled. Plain bytes and numeric enum values go through the generic importer.
+		const FByteProperty* ByteProperty = CastFieldChecked<const FByteProperty>(Property);
+		const UEnum* Enum = ByteProperty->Enum;
+		if (!Enum || !FChar::IsAlpha(Text.Len() > 0 ? Text[0] : TCHAR('\0')))
+		{
+			return false;
+		}
+
+		// Names that were never created can't be enum names, so the name is only looked up instead of added.
+		// Accepts both short names and "EnumName::Value".
+		const int32 EnumIndex = Enum->GetIndexByName(FName(*Text, FNAME_Find));
+		if (EnumIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		ByteProperty->SetPropertyValue_InContainer(Container, static_cast<uint8>(Enum->GetValueByIndex(EnumIndex)));
+		return true;
+	}
+
+	bool ImportEnum(const FProperty* Property, FString& Text, void* Container)
+	{
+		const FEnumProperty* EnumProperty = CastFieldChecked<const FEnumProperty>(Property);
+		const UEnum* Enum = EnumProperty->GetEnum();
+		if (!Enum || !FChar::IsAlpha(Text.Len() > 0 ? Text[0] : TCHAR('\0')))
+		{
+			return false;
+		}
+
+		// Same lookup as ImportByte.
+		const int32 EnumIndex = Enum->GetIndexByName(FName(*Text, FNAME_Find));
+		if (EnumIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		void* ValuePtr = EnumProperty->ContainerPtrToValuePtr<void>(Container);
+		EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, Enum->GetValueByIndex(EnumIndex));
+		return true;
+	}
+
+	bool ImportObject(const FProperty* Property, FString& Text, void* Container)
+	{
+		const FObjectProperty* ObjectProperty = CastFieldChecked<const FObjectProperty>(Property);
+		if (Text == TEXT("None"))
+		{
+			ObjectProperty->SetObjectPropertyValue_InContainer(Container, nullptr);
+			return true;
+		}
+
+		// Only plain paths of objects that are already loaded.
+		// Class prefixed paths, relative names and objects that need to be loaded go through the generic importer.
+		if (!Text.StartsWith(TEXT("/"), ESearchCase::CaseSensitive))
+		{
+			return false;
+		}
+
+		UObject* Object = StaticFindObject(ObjectProperty->PropertyClass, nullptr, *Text);
+		if (!Object)
+		{
+			return false;
+		}
+
+		ObjectProperty->SetObjectPropertyValue_InContainer(Container, Object);
+		return true;
+	}
+
+	bool ImportStruct(const FProperty* Property, FString& Text, void* Container)
+	{
+		const FStructProperty* StructProperty = CastFieldChecked<const FStructProperty>(Property);
+		if (StructProperty->Struct == TBaseStructure<FVector>::Get())
+		{
+			static const TCHAR* const FieldNames[] = { TEXT("X"), TEXT("Y"), TEXT("Z") };
+			double Values[3];
+			if (!ParseNumericStruct(Text, FieldNames, 3, Values))
+			{
+				return false;
+			}
+
+			*StructProperty->ContainerPtrToValuePtr<FVector>(Container) = FVector(Values[0], Values[1], Values[2]);
+			return true;
+		}
+
+		if (StructProperty->Struct == TBaseStructure<FLinearColor>::Get())
+		{
+			static const TCHAR* const FieldNames[] = { TEXT("R"), TEXT("G"), TEXT("B"), TEXT("A") };
+			double Values[4];
+			if (!ParseNumericStruct(Text, FieldNames, 4, Values))
+			{
+				return false;
+			}
+
+			*StructProperty->ContainerPtrToValuePtr<FLinearColor>(Container) = FLinearColor(static_cast<float>(Values[0]), static_cast<float>(Values[1]), static_cast<float>(Values[2]), static_cast<float>(Values[3]));
+			return true;
+		}
+
+		return false;
+	}
+}
+
+bool FActorIOArgumentImporter::TryImport(const FProperty* Property, FString& Text, void* Container)
+{
+	// Fixed size arrays are imported element by element by the generic importer.
+	if (!Property || Property->ArrayDim != 1)
+	{
+		return false;
+	}
+
+	const FImportFunc* ImportFunc = GetImportTable().Find(Property->GetClass());
+	return ImportFunc && (*ImportFunc)(Property, Text, Container);
+}
+
+bool FActorIOArgumentImporter::HasImporter(const FProperty* Property)
+{
+	return Property && GetImportTable().Contains(Property->GetClass());
+}
+
+const TMap<FFieldClass*, FActorIOArgumentImporter::FImportFunc>& FActorIOArgumentImporter::GetImportTable()
+{
+	// Keyed by the exact property class, so that derived properties (e.g. class properties) are never handled by the wrong importer.
+	static const TMap<FFieldClass*, FImportFunc> ImportTable =
+	{
+		{ FBoolProperty::StaticClass(), &ActorIOArgumentImporter::ImportBool },
+		{ FIntProperty::StaticClass(), &ActorIOArgumentImporter::ImportInt },
+		{ FFloatProperty::StaticClass(), &ActorIOArgumentImporter::ImportFloat },
+		{ FDoubleProperty::StaticClass(), &ActorIOArgumentImporter::ImportDouble },
+		{ FNameProperty::StaticClass(), &ActorIOArgumentImporter::ImportName },
+		{ FStrProperty::StaticClass(), &ActorIOArgumentImporter::ImportString },
+		{ FByteProperty::StaticClass(), &ActorIOArgumentImporter::ImportByte },
+		{ FEnumProperty::StaticClass(), &ActorIOArgumentImporter::ImportEnum },
+		{ FObjectProperty::StaticClass(), &ActorIOArgumentImporter::ImportObject },
+		{ FStructProperty::StaticClass(), &ActorIOArgumentImporter::ImportStruct },
+	};
+
+	return ImportTable;
+}
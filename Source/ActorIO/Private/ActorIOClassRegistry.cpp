@@ -0,0 +1,201 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "ActorIOClassRegistry.h"
+#include "ActorIOInterface.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/UnrealType.h"
+
+const FActorIOClassRegistration* UActorIOClassRegistry::FindRegistration(UClass* InClass) const
+{
+	if (!InClass)
+	{
+		return nullptr;
+	}
+
+	return Classes.Find(TSoftClassPtr<AActor>(FSoftObjectPath(InClass->GetClassPathName())));
+}
+
+void UActorIOClassRegistry::RegisterEvents(const FActorIOClassRegistration& InRegistration, AActor* InObject, FActorIOEventList& EventRegistry)
+{
+	for (const FActorIOCapturedEvent& Event : InRegistration.Events)
+	{
+		// Same as UActorIOLibrary::K2_RegisterIOEvent, the event processor is a function of the delegate owner.
+		UObject* DelegateOwner = InObject;
+		if (!Event.DelegateSubobject.IsNone())
+		{
+			DelegateOwner = InObject->GetDefaultSubobjectByName(Event.DelegateSubobject);
+		}
+
+		EventRegistry.RegisterEvent(FActorIOEvent()
+			.SetId(Event.EventId)
+			.SetDisplayName(ACTORIO_EDITOR_TEXT(Event.DisplayName))
+			.SetTooltipText(ACTORIO_EDITOR_TEXT(Event.TooltipText))
+			.SetBlueprintDelegate(DelegateOwner, Event.DelegateName)
+			.SetEventProcessor(DelegateOwner, Event.EventProcessor));
+	}
+}
+
+void UActorIOClassRegistry::RegisterFunctions(const FActorIOClassRegistration& InRegistration, FActorIOFunctionList& FunctionRegistry)
+{
+	for (const FActorIOCapturedFunction& Function : InRegistration.Functions)
+	{
+		FunctionRegistry.RegisterFunction(FActorIOFunction()
+			.SetId(Function.FunctionId)
+			.SetDisplayName(ACTORIO_EDITOR_TEXT(Function.DisplayName))
+			.SetTooltipText(ACTORIO_EDITOR_TEXT(Function.TooltipText))
+			.SetFunction(Function.FunctionToExec)
+			.SetSubobject(Function.TargetSubobject));
+	}
+}
+
+bool UActorIOClassRegistry::IsRegistrationValid(UClass* InClass, const FActorIOClassRegistration& InRegistration, FString& OutReason)
+{
+	AActor* ClassDefaultObject = InClass ? InClass->GetDefaultObject<AActor>() : nullptr;
+	if (!ClassDefaultObject)
+	{
+		OutReason = TEXT("Class is not an actor.");
+		return false;
+	}
+
+	for (const FActorIOCapturedEvent& Event : InRegistration.Events)
+	{
+		UObject* DelegateOwner = ClassDefaultObject;
+		if (!Event.DelegateSubobject.IsNone())
+		{
+			DelegateOwner = ClassDefaultObject->GetDefaultSubobjectByName(Event.DelegateSubobject);
+			if (!DelegateOwner)
+			{
+				OutReason = FString::Printf(TEXT("Default subobject '%s' of event '%s' was not found."), *Event.DelegateSubobject.ToString(), *Event.EventId.ToString());
+				return false;
+			}
+		}
+
+		if (!FindFProperty<FMulticastDelegateProperty>(DelegateOwner->GetClass(), Event.DelegateName))
+		{
+			OutReason = FString::Printf(TEXT("Event dispatcher '%s' of event '%s' was not found."), *Event.DelegateName.ToString(), *Event.EventId.ToString());
+			return false;
+		}
+
+		if (!Event.EventProcessor.IsNone() && !DelegateOwner->FindFunction(Event.EventProcessor))
+		{
+			OutReason = FString::Printf(TEXT("Event processor '%s' of event '%s' was not found."), *Event.EventProcessor.ToString(), *Event.EventId.ToString());
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UActorIOClassRegistry::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+#if WITH_EDITOR
+	// Registrations are captured when blueprints are compiled, but a blueprint can change without being compiled in this editor session
+	// (e.g. a parent class was changed, or the asset was updated from source control).
+	if (ObjectSaveContext.IsCooking())
+	{
+		RecaptureClasses();
+	}
+#endif
+}
+
+#if WITH_EDITOR
+void UActorIOClassRegistry::RecaptureClasses()
+{
+	TArray<TSoftClassPtr<AActor>> ClassKeys;
+	Classes.GenerateKeyArray(ClassKeys);
+
+	for (const TSoftClassPtr<AActor>& ClassKey : ClassKeys)
+	{
+		UClass* Class = ClassKey.LoadSynchronous();
+		if (!Class)
+		{
+			UE_LOG(LogActorIO, Warning, TEXT("Class '%s' was not found. Removed it from the I/O class registry."), *ClassKey.ToString());
+			Classes.Remove(ClassKey);
+			continue;
+		}
+
+		UE_CLOG(CaptureClass(Class), LogActorIO, Display, TEXT("Captured I/O registrations of class '%s' were out of date, and have been updated."), *Class->GetName());
+	}
+}
+
+bool UActorIOClassRegistry::CaptureClass(UClass* InClass)
+{
+	if (!InClass || !InClass->IsChildOf<AActor>() || !InClass->ImplementsInterface(UActorIOInterface::StaticClass()))
+	{
+		return RemoveClass(InClass);
+	}
+
+	// Only the blueprint side of the registration is captured.
+	// Native RegisterIOEvents and RegisterIOFunctions are still called at runtime, since those do not go through the script VM.
+	AActor* ClassDefaultObject = InClass->GetDefaultObject<AActor>();
+
+	FActorIOEventList CapturedEvents = FActorIOEventList();
+	IActorIOInterface::Execute_K2_RegisterIOEvents(ClassDefaultObject, CapturedEvents);
+
+	FActorIOFunctionList CapturedFunctions = FActorIOFunctionList();
+	IActorIOInterface::Execute_K2_RegisterIOFunctions(ClassDefaultObject, CapturedFunctions);
+
+	FActorIOClassRegistration NewRegistration = FActorIOClassRegistration();
+	for (const FActorIOEvent& Event : CapturedEvents.GetEvents())
+	{
+		// Only event dispatchers of the actor or its default subobjects can be restored from names.
+		UObject* DelegateOwner = Event.DelegateOwner.Get();
+		const bool bIsActorOrDefaultSubobject = DelegateOwner == ClassDefaultObject || (DelegateOwner && DelegateOwner->GetOuter() == ClassDefaultObject && DelegateOwner->IsDefaultSubobject());
+		const bool bIsProcessorOnOwner = !Event.EventProcessor.IsBound() || Event.EventProcessor.GetUObject() == DelegateOwner;
+		if (Event.DelegateType != FActorIOEvent::Type::BlueprintDelegate || !bIsActorOrDefaultSubobject || !bIsProcessorOnOwner)
+		{
+			UE_LOG(LogActorIO, Warning, TEXT("Could not capture I/O event '%s' of class '%s'. The class will use dynamic registration."), *Event.EventId.ToString(), *InClass->GetName());
+			return RemoveClass(InClass);
+		}
+
+		FActorIOCapturedEvent& NewEvent = NewRegistration.Events.AddDefaulted_GetRef();
+		NewEvent.EventId = Event.EventId;
+		NewEvent.DisplayName = Event.DisplayName;
+		NewEvent.TooltipText = Event.TooltipText;
+		NewEvent.DelegateName = Event.BlueprintDelegateName;
+		NewEvent.DelegateSubobject = DelegateOwner != ClassDefaultObject ? DelegateOwner->GetFName() : NAME_None;
+		NewEvent.EventProcessor = Event.EventProcessor.GetFunctionName();
+	}
+
+	for (const FActorIOFunction& Function : CapturedFunctions.GetFunctions())
+	{
+		FActorIOCapturedFunction& NewFunction = NewRegistration.Functions.AddDefaulted_GetRef();
+		NewFunction.FunctionId = Function.FunctionId;
+		NewFunction.DisplayName = Function.DisplayName;
+		NewFunction.TooltipText = Function.TooltipText;
+		NewFunction.FunctionToExec = Function.FunctionToExec;
+		NewFunction.TargetSubobject = Function.TargetSubobject;
+	}
+
+	const TSoftClassPtr<AActor> ClassKey = TSoftClassPtr<AActor>(FSoftObjectPath(InClass->GetClassPathName()));
+	const FActorIOClassRegistration* ExistingRegistration = Classes.Find(ClassKey);
+	if (ExistingRegistration && FActorIOClassRegistration::StaticStruct()->CompareScriptStruct(ExistingRegistration, &NewRegistration, PPF_None))
+	{
+		return false;
+	}
+
+	Modify();
+	Classes.Add(ClassKey, MoveTemp(NewRegistration));
+	return true;
+}
+
+bool UActorIOClassRegistry::RemoveClass(UClass* InClass)
+{
+	if (!InClass)
+	{
+		return false;
+	}
+
+	const TSoftClassPtr<AActor> ClassKey = TSoftClassPtr<AActor>(FSoftObjectPath(InClass->GetClassPathName()));
+	if (!Classes.Contains(ClassKey))
+	{
+		return false;
+	}
+
+	Modify();
+	Classes.Remove(ClassKey);
+	return true;
+}
+#endif
@@ -2,30 +2,57 @@
 
 #include "ActorIOComponent.h"
 #include "ActorIOAction.h"
+#include "ActorIOSubsystemBase.h"
+#include "ActorIOSettings.h"
 #include "ActorIOVersions.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
 #include "Serialization/MemoryWriter.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 #include "Serialization/Formatters/BinaryArchiveFormatter.h"
 #include "Logging/MessageLog.h"
 #include "Misc/UObjectToken.h"
+#include "Misc/Crc.h"
+#include "UObject/ObjectSaveContext.h"
 
 #define LOCTEXT_NAMESPACE "ActorIO"
 
+const FName UActorIOComponent::DispatchFunctionNames[] =
+{
+	GET_FUNCTION_NAME_CHECKED(UActorIOComponent, DispatchEvent0),
+	GET_FUNCTION_NAME_CHECKED(UActorIOComponent, DispatchEvent1),
+	GET_FUNCTION_NAME_CHECKED(UActorIOComponent, DispatchEvent2),
+	GET_FUNCTION_NAME_CHECKED(UActorIOComponent, DispatchEvent3),
+	GET_FUNCTION_NAME_CHECKED(UActorIOComponent, DispatchEvent4),
+	GET_FUNCTION_NAME_CHECKED(UActorIOComponent, DispatchEvent5),
+	GET_FUNCTION_NAME_CHECKED(UActorIOComponent, DispatchEvent6),
+	GET_FUNCTION_NAME_CHECKED(UActorIOComponent, DispatchEvent7)
+};
+
 UActorIOComponent::UActorIOComponent()
 {
 	// Required for component initialize/deinitialize callbacks.
 	bWantsInitializeComponent = true;
 
 	Actions = TArray<TObjectPtr<UActorIOAction>>();
+	bActionDataSlotsCreated = false;
+	bBoundFromLogicGraph = false;
+	bBindingDeferred = false;
 }
 
 void UActorIOComponent::OnRegister()
 {
 	Super::OnRegister();
 
+	// Cooked levels may store actions as plain data.
+	if (ActionData.Num() > 0 && !bActionDataSlotsCreated)
+	{
+		CreateActionDataSlots();
+	}
+
 	// Clean up the action list whenever the component is (re)registered.
 	CompactActions();
 }
@@ -34,19 +61,46 @@ void UActorIOComponent::InitializeComponent()
 {
 	Super::InitializeComponent();
 
-	BindActions();
+	// Remember the authored action layout, so that we know whether executed states can be saved by index.
+	InitialLayoutHash = GetActionLayoutHash();
+
+	// Let the I/O subsystem bind our actions later if the level is being streamed in with time sliced binding.
+	UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(this);
+	if (IOSubsystem && IOSubsystem->ShouldDeferBinding(this))
+	{
+		bBindingDeferred = true;
+		IOSubsystem->QueueComponentBinding(this);
+	}
+	else
+	{
+		BindActions();
+	}
+}
+
+void UActorIOComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Events of the owning actor can fire from begin play onward, so the actions must be bound by now even if it is not our turn yet.
+	BindDeferredActions();
 }
 
 UActorIOAction* UActorIOComponent::CreateNewAction()
 {
 	UActorIOAction* NewAction = NewObject<UActorIOAction>(this, NAME_None, RF_Transactional);
+	NewAction->AssignNewActionId();
 	Actions.Add(NewAction);
+	AddActionToCluster(NewAction);
 	return NewAction;
 }
 
 void UActorIOComponent::RemoveAction(UActorIOAction* InAction)
 {
 	check(InAction);
+
+	// Plain data actions are referred to by index, which is about to change.
+	ReleaseActionData();
+
 	InAction->MarkAsGarbage();
 
 	const int32 ActionIdx = Actions.IndexOfByKey(InAction);
@@ -58,6 +112,9 @@ void UActorIOComponent::MoveAction(int32 OriginalIndex, int32 NewIndex)
 	// Uses same move implementation as properties in the editor.
 	// @see FPropertyValueImpl::MoveElementTo
 
+	// Plain data actions are referred to by index, which is about to change.
+	ReleaseActionData();
+
 	if (NewIndex > OriginalIndex)
 	{
 		Actions.InsertDefaulted(NewIndex + 1);
@@ -76,170 +133,1134 @@ void UActorIOComponent::CompactActions()
 {
 	for (int32 ActionIdx = Actions.Num() - 1; ActionIdx >= 0; --ActionIdx)
 	{
-		if (!Actions[ActionIdx].Get())
+		// Plain data actions have no object until they are needed.
+		if (!Actions[ActionIdx].Get() && !IsDataAction(ActionIdx))
 		{
 			Actions.RemoveAt(ActionIdx);
 		}
 	}
 }
 
-void UActorIOComponent::BindActions()
+void UActorIOComponent::CreateActionDataSlots()
 {
-	for (int32 ActionIdx = 0; ActionIdx != Actions.Num(); ++ActionIdx)
+	Actions.Reset(ActionData.Num());
+	Actions.SetNum(ActionData.Num());
+	bActionDataSlotsCreated = true;
+}
+
+UActorIOAction* UActorIOComponent::GetOrCreateAction(int32 ActionIdx)
+{
+	if (!Actions.IsValidIndex(ActionIdx))
 	{
-		UActorIOAction* Action = Actions[ActionIdx].Get();
-		if (IsValid(Action))
+		return nullptr;
+	}
+
+	UActorIOAction* Action = Actions[ActionIdx].Get();
+	if (!Action && IsDataAction(ActionIdx))
+	{
+		Action = CreateActionFromData(ActionIdx);
+	}
+
+	return Action;
+}
+
+UActorIOAction* UActorIOComponent::CreateActionFromData(int32 ActionIdx)
+{
+	// Same name as the original action, so that the layout hash and saved executed states stay valid.
+	const FActorIOActionData& Data = ActionData[ActionIdx];
+	UActorIOAction* NewAction = NewObject<UActorIOAction>(this, Data.ActionName, RF_Transient);
+	NewAction->InitFromActionData(Data);
+	Actions[ActionIdx] = NewAction;
+	AddActionToCluster(NewAction);
+
+	if (bBoundFromLogicGraph)
+	{
+		NewAction->SetArgumentTokens(LogicGraph.Actions[ActionIdx].ArgumentTokens);
+		NewAction->SetDirectRelayTrigger(LogicGraph.Actions[ActionIdx].bDirectRelayTrigger);
+	}
+
+	// The I/O event of the action may already be bound through an event dispatcher.
+	const int32 DispatcherIdx = FindEventDispatcherOfAction(ActionIdx);
+	if (DispatcherIdx != INDEX_NONE)
+	{
+		const FActorIOEventDispatcher& Dispatcher = EventDispatchers[DispatcherIdx];
+		NewAction->SetDispatchedBinding(Dispatcher.EventProcessor, Dispatcher.DelegateOwner.Get(true));
+	}
+
+	return NewAction;
+}
+
+void UActorIOComponent::ReleaseActionData()
+{
+	if (ActionData.Num() == 0)
+	{
+		return;
+	}
+
+	const bool bWasBound = EventDispatchers.ContainsByPredicate([](const FActorIOEventDispatcher& Dispatcher)
+	{
+		return Dispatcher.IsBound();
+	});
+
+	for (int32 ActionIdx = 0; ActionIdx != ActionData.Num(); ++ActionIdx)
+	{
+		GetOrCreateAction(ActionIdx);
+	}
+
+	// Actions of the event dispatchers are bound again with their own delegates.
+	UnbindEventDispatchers(false);
+	EventDispatchers.Empty();
+	ActionData.Empty();
+
+	if (bWasBound)
+	{
+		BindActions();
+	}
+}
+
+int32 UActorIOComponent::GetEventDispatcherIndex(const UFunction* Function) const
+{
+	if (!Function || EventDispatchers.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const FName FunctionName = Function->GetFName();
+	for (int32 DispatcherIdx = 0; DispatcherIdx != EventDispatchers.Num(); ++DispatcherIdx)
+	{
+		if (DispatchFunctionNames[DispatcherIdx] == FunctionName)
 		{
-			Action->BindAction();
+			return EventDispatchers[DispatcherIdx].IsBound() ? DispatcherIdx : INDEX_NONE;
 		}
 	}
+
+	return INDEX_NONE;
 }
 
-void UActorIOComponent::UnbindActions()
+int32 UActorIOComponent::FindEventDispatcherOfAction(int32 ActionIdx) const
 {
-	for (int32 ActionIdx = 0; ActionIdx != Actions.Num(); ++ActionIdx)
+	return EventDispatchers.IndexOfByPredicate([ActionIdx](const FActorIOEventDispatcher& Dispatcher)
 	{
-		UActorIOAction* Action = Actions[ActionIdx].Get();
+		return Dispatcher.IsBound() && Dispatcher.ActionIndices.Contains(ActionIdx);
+	});
+}
+
+void UActorIOComponent::DispatchEvent(int32 DispatcherIdx, void* Parms)
+{
+	// Copied, since executing an action may change the event dispatchers (e.g. the owning actor is destroyed).
+	const TArray<int32, TInlineAllocator<16>> ActionIndices(EventDispatchers[DispatcherIdx].ActionIndices);
+	for (int32 ActionIdx : ActionIndices)
+	{
+		UActorIOAction* Action = GetOrCreateAction(ActionIdx);
 		if (IsValid(Action))
 		{
-			Action->UnbindAction();
+			Action->ExecuteFromDispatcher(Parms);
 		}
 	}
 }
 
-void UActorIOComponent::SerializeToRawData(TArray<uint8>& RawData)
+void UActorIOComponent::ProcessEvent(UFunction* Function, void* Parms)
 {
-	FMemoryWriter Archive = FMemoryWriter(RawData);
-	FObjectAndNameAsStringProxyArchive ProxyArchive = FObjectAndNameAsStringProxyArchive(Archive, false);
-	ProxyArchive.ArIsSaveGame = true;
+	// Same idea as UActorIOAction::ProcessEvent.
+	// Event dispatchers bind our dispatch functions to I/O events, and we catch the call here to get the original script VM memory.
+	// The dispatch functions do nothing, so there is no need to let the script VM call them afterwards.
+	const int32 DispatcherIdx = GetEventDispatcherIndex(Function);
+	if (DispatcherIdx != INDEX_NONE)
+	{
+		DispatchEvent(DispatcherIdx, Parms);
+		return;
+	}
 
-	FBinaryArchiveFormatter Formatter = FBinaryArchiveFormatter(ProxyArchive);
-	FStructuredArchive StructuredArchive = FStructuredArchive(Formatter);
+	Super::ProcessEvent(Function, Parms);
+}
 
-	FStructuredArchive::FSlot RootSlot = StructuredArchive.Open();
-	Serialize(RootSlot.EnterRecord());
+void UActorIOComponent::AddActionToCluster(UActorIOAction* InAction)
+{
+	// Clusters are only created when the component is loaded. @see UActorIOComponent::CanBeClusterRoot
+	const bool bIsInCluster = HasAnyInternalFlags(EInternalObjectFlags::ClusterRoot) || GetOwnerIndex() != 0;
+	if (bIsInCluster)
+	{
+		InAction->AddToCluster(this);
+	}
 }
 
-void UActorIOComponent::RestoreFromRawData(TArray<uint8>& RawData)
+void UActorIOComponent::BindActions()
 {
-	FMemoryReader Archive = FMemoryReader(RawData);
-	FObjectAndNameAsStringProxyArchive ProxyArchive = FObjectAndNameAsStringProxyArchive(Archive, false);
-	ProxyArchive.ArIsSaveGame = true;
+	AActor* ActionOwner = GetOwner();
+	if (!IsValid(ActionOwner) || Actions.Num() == 0)
+	{
+		return;
+	}
 
-	FBinaryArchiveFormatter Formatter = FBinaryArchiveFormatter(ProxyArchive);
-	FStructuredArchive StructuredArchive = FStructuredArchive(Formatter);
+	// Cooked levels come with a compiled logic graph, so there is no need to build the list of I/O events.
+	if (BindActionsFromLogicGraph())
+	{
+		return;
+	}
 
-	FStructuredArchive::FSlot RootSlot = StructuredArchive.Open();
-	Serialize(RootSlot.EnterRecord());
+	TArray<int32, TInlineAllocator<32>> ActionIndices;
+	for (int32 ActionIdx = 0; ActionIdx != Actions.Num(); ++ActionIdx)
+	{
+		ActionIndices.Add(ActionIdx);
+	}
+
+	BindActionsFromEventList(ActionIndices);
 }
 
-void UActorIOComponent::UninitializeComponent()
+void UActorIOComponent::BindEventDispatcher(const FActorIOEvent& InEvent, TArray<int32>&& ActionIndices)
 {
-	UnbindActions();
+	AActor* ActionOwner = GetOwner();
 
-	Super::UninitializeComponent();
-}
+	// Dispatchers may still be bound if the level of the owning actor was removed and then added back to the world.
+	// Action objects of these were removed from the action registry when the level was removed. @see UActorIOComponent::UnbindEventDispatchers
+	const int32 BoundDispatcherIdx = EventDispatchers.IndexOfByPredicate([&InEvent](const FActorIOEventDispatcher& Dispatcher)
+	{
+		return Dispatcher.IsBound() && Dispatcher.EventId == InEvent.EventId;
+	});
 
-void UActorIOComponent::Serialize(FStructuredArchive::FRecord Record)
-{
-	FArchive& UnderlyingArchive = Record.GetUnderlyingArchive();
-	if (UnderlyingArchive.IsSaveGame())
+	if (BoundDispatcherIdx != INDEX_NONE)
 	{
-		UnderlyingArchive.UsingCustomVersion(FActorIOActionVersion::GUID);
+		for (int32 ActionIdx : EventDispatchers[BoundDispatcherIdx].ActionIndices)
+		{
+			if (UActorIOAction* Action = Actions[ActionIdx].Get())
+			{
+				Action->AddToActionRegistry();
+			}
+		}
 
-		int32 Version = UnderlyingArchive.CustomVer(FActorIOActionVersion::GUID);
-		Record << SA_VALUE(TEXT("Version"), Version);
+		return;
+	}
 
-		if (UnderlyingArchive.IsLoading())
+	// Actions that were bound one by one before keep their own delegate.
+	ActionIndices.RemoveAll([this](int32 ActionIdx)
+	{
+		UActorIOAction* Action = Actions[ActionIdx].Get();
+		if (Action && Action->IsBound())
 		{
-			UnderlyingArchive.SetCustomVersion(FActorIOActionVersion::GUID, Version, TEXT("ActorIOActionVer"));
+			Action->AddToActionRegistry();
+			return true;
 		}
 
-		TArray<UActorIOAction*> SerializeActions;
-		if (UnderlyingArchive.IsSaving())
+		return false;
+	});
+
+	if (ActionIndices.Num() == 0)
+	{
+		return;
+	}
+
+	FActorIOEventBinding EventBinding;
+	if (!EventBinding.Resolve(InEvent))
+	{
+		UE_CLOG(DebugIOActions, LogActorIO, Error, TEXT("Actor '%s' could not bind actions to '%s' - %s"), *ActionOwner->GetActorNameOrLabel(), *InEvent.EventId.ToString(), *FActorIOEventBinding::GetResolveErrorReason(InEvent));
+		return;
+	}
+
+	int32 DispatcherIdx = EventDispatchers.IndexOfByPredicate([](const FActorIOEventDispatcher& Dispatcher)
+	{
+		return !Dispatcher.IsBound();
+	});
+
+	if (DispatcherIdx == INDEX_NONE && EventDispatchers.Num() < MaxEventDispatchers)
+	{
+		DispatcherIdx = EventDispatchers.AddDefaulted();
+	}
+
+	if (DispatcherIdx == INDEX_NONE)
+	{
+		// Out of dispatch slots, so the actions are created and bound one by one.
+		for (int32 ActionIdx : ActionIndices)
 		{
-			for (const TObjectPtr<UActorIOAction>& ActionPtr : Actions)
+			UActorIOAction* Action = GetOrCreateAction(ActionIdx);
+			if (IsValid(Action))
 			{
-				UActorIOAction* Action = ActionPtr.Get();
-				if (Action && Action->ShouldSerializeToArchive(UnderlyingArchive))
-				{
-					SerializeActions.Add(Action);
-				}
+				Action->BindAction(InEvent, EventBinding);
 			}
 		}
 
-		int32 NumActions = SerializeActions.Num();
-		FStructuredArchive::FMap ActionsMap = Record.EnterMap(TEXT("Actions"), NumActions);
+		return;
+	}
 
-		for (int32 ActionIdx = 0; ActionIdx != NumActions; ++ActionIdx)
+	FActorIOEventDispatcher& Dispatcher = EventDispatchers[DispatcherIdx];
+	Dispatcher.EventId = InEvent.EventId;
+	Dispatcher.ActionIndices = MoveTemp(ActionIndices);
+	Dispatcher.EventProcessor = InEvent.EventProcessor;
+	Dispatcher.DelegateOwner = EventBinding.DelegateOwner;
+	Dispatcher.Delegate.BindUFunction(this, DispatchFunctionNames[DispatcherIdx]);
+	EventBinding.AddDelegate(Dispatcher.Delegate);
+
+	// Action objects that were already created are executed through the dispatcher too.
+	for (int32 ActionIdx : Dispatcher.ActionIndices)
+	{
+		if (UActorIOAction* Action = Actions[ActionIdx].Get())
+		{
+			Action->SetDispatchedBinding(Dispatcher.EventProcessor, Dispatcher.DelegateOwner.Get(true));
+		}
+	}
+}
+
+void UActorIOComponent::UnbindEventDispatchers(bool bOwnerIsBeingRemoved)
+{
+	AActor* ActionOwner = GetOwner();
+
+	TArray<int32, TInlineAllocator<MaxEventDispatchers>> DispatchersToUnbind;
+	for (int32 DispatcherIdx = 0; DispatcherIdx != EventDispatchers.Num(); ++DispatcherIdx)
+	{
+		const FActorIOEventDispatcher& Dispatcher = EventDispatchers[DispatcherIdx];
+		if (!Dispatcher.IsBound())
 		{
-			UActorIOAction* ActionPtr = nullptr;
-			FString ActionName;
+			continue;
+		}
 
-			if (UnderlyingArchive.IsSaving())
+		// Action objects of the dispatcher are registered, but they are not bound on their own.
+		for (int32 ActionIdx : Dispatcher.ActionIndices)
+		{
+			if (UActorIOAction* Action = Actions[ActionIdx].Get())
 			{
-				ActionPtr = SerializeActions[ActionIdx];
-				ActionName = ActionPtr->GetName();
+				Action->RemoveFromActionRegistry();
 			}
+		}
 
-			FStructuredArchive::FSlot ActionSlot = ActionsMap.EnterElement(ActionName);
-			FStructuredArchive::FRecord ActionRecord = ActionSlot.EnterRecord();
-
-			const int64 DataSizePosition = UnderlyingArchive.Tell();
-			int64 DataSize = 0;
-
-			// Pre-serialize the data size. We'll rewrite this after serializing the action.
-			if (!UnderlyingArchive.IsTextFormat())
+		if (bOwnerIsBeingRemoved)
+		{
+			UObject* DelegateOwner = Dispatcher.DelegateOwner.Get(true);
+			if (DelegateOwner && (DelegateOwner == ActionOwner || DelegateOwner->IsIn(ActionOwner)))
 			{
-				ActionRecord << SA_VALUE(TEXT("DataSize"), DataSize);
+				// The dispatcher is leaving the world either way.
+				continue;
 			}
+		}
+
+		DispatchersToUnbind.Add(DispatcherIdx);
+	}
 
-			const int64 BeginDataPosition = UnderlyingArchive.Tell();
+	if (DispatchersToUnbind.Num() == 0)
+	{
+		return;
+	}
 
-			if (UnderlyingArchive.IsLoading())
-			{
-				ActionPtr = FindObjectFast<UActorIOAction>(this, *ActionName);
-				UE_CLOG(!ActionPtr, LogActorIO, Warning, TEXT("%s - No action found with name '%s'."), *GetPathName(), *ActionName);
+	const FActorIOEventList ValidEvents = IActorIO::GetEventsForObject(ActionOwner);
+	for (int32 DispatcherIdx : DispatchersToUnbind)
+	{
+		FActorIOEventDispatcher& Dispatcher = EventDispatchers[DispatcherIdx];
 
-				if (ActionPtr)
-				{
-					ActionPtr->Serialize(ActionRecord);
-				}
-				
-				// Seek to the end of the data block in case we serialized less.
-				if (!UnderlyingArchive.IsTextFormat())
-				{
-					if (!ensureMsgf(UnderlyingArchive.Tell() <= BeginDataPosition + DataSize, TEXT("%s - Serialized more data then expected when loading %s!"), *GetPathName(), *ActionName))
-					{
-						UnderlyingArchive.SetError();
-						return;
-					}
+		const FActorIOEvent* TargetEvent = ValidEvents.GetEvent(Dispatcher.EventId);
+		FActorIOEventBinding EventBinding;
+		if (TargetEvent && EventBinding.Resolve(*TargetEvent, true))
+		{
+			EventBinding.RemoveDelegate(Dispatcher.Delegate);
+		}
+		else
+		{
+			UE_CLOG(DebugIOActions, LogActorIO, Error, TEXT("Actor '%s' could not unbind actions from '%s' - Event was not found."), *ActionOwner->GetActorNameOrLabel(), *Dispatcher.EventId.ToString());
+		}
 
-					UnderlyingArchive.Seek(BeginDataPosition + DataSize);
-				}
-			}
-			else
-			{
-				check(ActionPtr);
-				ActionPtr->Serialize(ActionRecord);
+		// Free the dispatch slot either way.
+		Dispatcher = FActorIOEventDispatcher();
+	}
+}
 
-				// Seek back and re-write the data size with the actual size.
-				if (!UnderlyingArchive.IsTextFormat())
-				{
-					const int64 EndDataPosition = UnderlyingArchive.Tell();
-					DataSize = EndDataPosition - BeginDataPosition;
+void UActorIOComponent::BindActionsFromEventList(TConstArrayView<int32> ActionIndices)
+{
+	AActor* ActionOwner = GetOwner();
 
-					UnderlyingArchive.Seek(DataSizePosition);
-					UnderlyingArchive << DataSize;
-					UnderlyingArchive.Seek(EndDataPosition);
-				}
+	// Build the list of I/O events once for all actions, instead of once per action.
+	// Delegates are also resolved once per I/O event, and reused for every action bound to the same event.
+	// Actions are still bound in their original order, so the execution order of actions on the same event is unchanged.
+	const FActorIOEventList ValidEvents = IActorIO::GetEventsForObject(ActionOwner);
+	TMap<FName, FActorIOEventBinding> ResolvedBindings;
+
+	// Plain data actions are grouped by event, and bound through event dispatchers instead.
+	TMap<FName, TArray<int32>> DataActionsByEvent;
+
+	for (int32 ActionIdx : ActionIndices)
+	{
+		if (IsDataAction(ActionIdx))
+		{
+			DataActionsByEvent.FindOrAdd(ActionData[ActionIdx].EventId).Add(ActionIdx);
+			continue;
+		}
+
+		UActorIOAction* Action = Actions[ActionIdx].Get();
+		if (!IsValid(Action))
+		{
+			continue;
+		}
+
+		if (Action->IsBound())
+		{
+			// Actions may still be bound if the level of the owning actor was removed and then added back to the world.
+			// These were removed from the action registry when the level was removed. @see UActorIOComponent::UnbindActions
+			Action->AddToActionRegistry();
+			continue;
+		}
+
+		const FActorIOEvent* TargetEvent = ValidEvents.GetEvent(Action->EventId);
+		if (!TargetEvent)
+		{
+			UE_CLOG(DebugIOActions, LogActorIO, Error, TEXT("Actor '%s' could not bind action to '%s' - Event was not found."), *ActionOwner->GetActorNameOrLabel(), *Action->EventId.ToString());
+			continue;
+		}
+
+		FActorIOEventBinding* EventBinding = ResolvedBindings.Find(Action->EventId);
+		if (!EventBinding)
+		{
+			EventBinding = &ResolvedBindings.Add(Action->EventId);
+			EventBinding->Resolve(*TargetEvent);
+		}
+
+		Action->BindAction(*TargetEvent, *EventBinding);
+	}
+
+	for (TPair<FName, TArray<int32>>& DataActions : DataActionsByEvent)
+	{
+		const FActorIOEvent* TargetEvent = ValidEvents.GetEvent(DataActions.Key);
+		if (!TargetEvent)
+		{
+			UE_CLOG(DebugIOActions, LogActorIO, Error, TEXT("Actor '%s' could not bind action to '%s' - Event was not found."), *ActionOwner->GetActorNameOrLabel(), *DataActions.Key.ToString());
+			continue;
+		}
+
+		BindEventDispatcher(*TargetEvent, MoveTemp(DataActions.Value));
+	}
+}
+
+void UActorIOComponent::BindDeferredActions()
+{
+	if (bBindingDeferred)
+	{
+		bBindingDeferred = false;
+		BindActions();
+	}
+}
+
+void UActorIOComponent::UnbindActions()
+{
+	AActor* ActionOwner = GetOwner();
+	if (!ActionOwner || Actions.Num() == 0)
+	{
+		return;
+	}
+
+	// When the owning actor is being removed, delegates that live on the actor (or its subobjects) go away with it.
+	// There is no need to remove our functions from them one by one, which makes unloading dense levels much cheaper.
+	// These actions are left in a bound state, since they are going away together with the delegates.
+	const bool bOwnerIsBeingRemoved = IsOwnerBeingRemoved();
+
+	// Plain data actions are bound through the event dispatchers.
+	UnbindEventDispatchers(bOwnerIsBeingRemoved);
+
+	TArray<UActorIOAction*, TInlineAllocator<16>> ActionsToUnbind;
+	for (const TObjectPtr<UActorIOAction>& ActionPtr : Actions)
+	{
+		UActorIOAction* Action = ActionPtr.Get();
+		if (!IsValid(Action) || !Action->IsBound())
+		{
+			continue;
+		}
+
+		if (bOwnerIsBeingRemoved)
+		{
+			UObject* DelegateOwner = Action->GetBoundDelegateOwner();
+			if (DelegateOwner && (DelegateOwner == ActionOwner || DelegateOwner->IsIn(ActionOwner)))
+			{
+				// The action is leaving the world either way.
+				Action->RemoveFromActionRegistry();
+				continue;
 			}
 		}
+
+		ActionsToUnbind.Add(Action);
 	}
-	else
+
+	// Only build the list of I/O events if there is anything to unbind.
+	if (ActionsToUnbind.Num() == 0)
 	{
-		// Use the default property serialization if not saving game data.
-		Super::Serialize(Record);
+		return;
+	}
+
+	const FActorIOEventList ValidEvents = IActorIO::GetEventsForObject(ActionOwner);
+	TMap<FName, FActorIOEventBinding> ResolvedBindings;
+
+	for (UActorIOAction* Action : ActionsToUnbind)
+	{
+		const FActorIOEvent* TargetEvent = ValidEvents.GetEvent(Action->EventId);
+		if (!TargetEvent)
+		{
+			// This should be impossible to reach.
+			// Only case when this can happen is if your register IO events function does not always return the same list of events.
+			checkf(false, TEXT("Could not unbind action because the I/O event that we were bound to was not found?!"));
+			continue;
+		}
+
+		FActorIOEventBinding* EventBinding = ResolvedBindings.Find(Action->EventId);
+		if (!EventBinding)
+		{
+			EventBinding = &ResolvedBindings.Add(Action->EventId);
+			EventBinding->Resolve(*TargetEvent, true);
+		}
+
+		Action->UnbindAction(*TargetEvent, *EventBinding);
+	}
+}
+
+bool UActorIOComponent::BindActionsFromLogicGraph()
+{
+	// The graph is only trusted in cooked builds, since the level may have been edited since the graph was compiled in the editor.
+	if (!FPlatformProperties::RequiresCookedData() || !LogicGraph.IsCompiled() || LogicGraph.Actions.Num() != Actions.Num())
+	{
+		return false;
+	}
+
+	const uint32 LayoutHash = InitialLayoutHash.IsSet() ? InitialLayoutHash.GetValue() : GetActionLayoutHash();
+	if (LogicGraph.LayoutHash != LayoutHash)
+	{
+		return false;
+	}
+
+	// Plain data actions that are created later get their argument tokens when they are created.
+	bBoundFromLogicGraph = true;
+
+	AActor* ActionOwner = GetOwner();
+	for (int32 ActionIdx = 0; ActionIdx != Actions.Num(); ++ActionIdx)
+	{
+		UActorIOAction* Action = Actions[ActionIdx].Get();
+		if (Action)
+		{
+			Action->SetArgumentTokens(LogicGraph.Actions[ActionIdx].ArgumentTokens);
+			Action->SetDirectRelayTrigger(LogicGraph.Actions[ActionIdx].bDirectRelayTrigger);
+		}
+	}
+
+	for (const FActorIOGraphEvent& GraphEvent : LogicGraph.Events)
+	{
+		FActorIOEvent TargetEvent = FActorIOEvent();
+		if (!GraphEvent.MakeEvent(ActionOwner, TargetEvent))
+		{
+			bBoundFromLogicGraph = false;
+			return false;
+		}
+
+		// Plain data actions share a single delegate per event.
+		if (ActionData.Num() > 0)
+		{
+			BindEventDispatcher(TargetEvent, CopyTemp(GraphEvent.ActionIndices));
+			continue;
+		}
+
+		FActorIOEventBinding EventBinding;
+		EventBinding.Resolve(TargetEvent);
+
+		for (int32 ActionIdx : GraphEvent.ActionIndices)
+		{
+			UActorIOAction* Action = Actions[ActionIdx].Get();
+			if (!IsValid(Action))
+			{
+				continue;
+			}
+
+			if (Action->IsBound())
+			{
+				Action->AddToActionRegistry();
+			}
+			else
+			{
+				Action->BindAction(TargetEvent, EventBinding);
+			}
+		}
+	}
+
+	// Actions of events that could not be compiled still need the list of I/O events.
+	if (LogicGraph.RuntimeBoundActions.Num() > 0)
+	{
+		BindActionsFromEventList(LogicGraph.RuntimeBoundActions);
+	}
+
+	return true;
+}
+
+#if WITH_EDITOR
+void UActorIOComponent::CompileLogicGraph()
+{
+	LogicGraph.Reset();
+
+	AActor* ActionOwner = GetOwner();
+	if (!ActionOwner || Actions.Num() == 0)
+	{
+		return;
+	}
+
+	const FActorIOEventList ValidEvents = IActorIO::GetEventsForObject(ActionOwner);
+	TMap<FName, int32> EventIndices;
+
+	// Events registered by the I/O subsystem are not in the list of I/O events when the level is not in a game world.
+	// These are compiled from the registration table of the subsystem class instead.
+	TArray<FActorIORegisteredEvent> RegisteredEvents;
+	bool bHasRegisteredEvents = false;
+
+	// Events that can't be compiled at all are bound at runtime. Actions of other events still use the graph.
+	TSet<FName> RuntimeBoundEvents;
+
+	const UActorIOSettings* IOSettings = UActorIOSettings::Get();
+
+	// The cooked component only has the actions that are not stripped, since null actions are removed when it is registered.
+	TArray<TObjectPtr<UActorIOAction>> CookedActions;
+	CookedActions.Reserve(Actions.Num());
+	for (const TObjectPtr<UActorIOAction>& ActionPtr : Actions)
+	{
+		const UActorIOAction* Action = ActionPtr.Get();
+		if (Action && !Action->IsStrippedFromCook())
+		{
+			CookedActions.Add(ActionPtr);
+		}
+	}
+
+	if (CookedActions.Num() == 0)
+	{
+		return;
+	}
+
+	FActorIOLogicGraph NewGraph = FActorIOLogicGraph();
+	NewGraph.LayoutHash = GetActionLayoutHash(CookedActions);
+	NewGraph.Actions.SetNum(CookedActions.Num());
+
+	for (int32 ActionIdx = 0; ActionIdx != CookedActions.Num(); ++ActionIdx)
+	{
+		const UActorIOAction* Action = CookedActions[ActionIdx].Get();
+
+		UActorIOAction::TokenizeArguments(Action->FunctionArguments, NewGraph.Actions[ActionIdx].ArgumentTokens);
+		NewGraph.Actions[ActionIdx].bDirectRelayTrigger = IOSettings->bCollapseRelayChains && Action->CanTriggerRelayDirectly();
+
+		if (RuntimeBoundEvents.Contains(Action->EventId))
+		{
+			NewGraph.RuntimeBoundActions.Add(ActionIdx);
+			continue;
+		}
+
+		int32* EventIdx = EventIndices.Find(Action->EventId);
+		if (!EventIdx)
+		{
+			FActorIOGraphEvent NewEvent = FActorIOGraphEvent();
+			bool bCompiled = false;
+
+			const FActorIOEvent* TargetEvent = ValidEvents.GetEvent(Action->EventId);
+			if (TargetEvent)
+			{
+				bCompiled = FActorIOGraphEvent::Compile(*TargetEvent, ActionOwner, NewEvent);
+			}
+			else
+			{
+				if (!bHasRegisteredEvents)
+				{
+					UActorIOSubsystemBase::GetRegisteredEventsForClass(ActionOwner->GetClass(), RegisteredEvents);
+					bHasRegisteredEvents = true;
+				}
+
+				const FActorIORegisteredEvent* RegisteredEvent = RegisteredEvents.FindByPredicate([Action](const FActorIORegisteredEvent& Element)
+				{
+					return Element.EventId == Action->EventId;
+				});
+
+				bCompiled = RegisteredEvent && FActorIOGraphEvent::CompileRegistered(*RegisteredEvent, ActionOwner, NewEvent);
+			}
+
+			if (!bCompiled)
+			{
+				UE_LOG(LogActorIO, Verbose, TEXT("%s - Could not compile I/O event '%s'. Its actions will be bound at runtime."), *GetPathName(), *Action->EventId.ToString());
+				RuntimeBoundEvents.Add(Action->EventId);
+				NewGraph.RuntimeBoundActions.Add(ActionIdx);
+				continue;
+			}
+
+			EventIdx = &EventIndices.Add(Action->EventId, NewGraph.Events.Add(MoveTemp(NewEvent)));
+		}
+
+		NewGraph.Events[*EventIdx].ActionIndices.Add(ActionIdx);
+	}
+
+	LogicGraph = MoveTemp(NewGraph);
+}
+
+void UActorIOComponent::StripDeadActions(bool bCooking)
+{
+	const bool bShouldStrip = bCooking && UActorIOSettings::Get()->bStripDeadActionsOnCook;
+	for (const TObjectPtr<UActorIOAction>& ActionPtr : Actions)
+	{
+		UActorIOAction* Action = ActionPtr.Get();
+		if (!Action)
+		{
+			continue;
+		}
+
+		FString StripReason;
+		const bool bStripped = bShouldStrip && Action->CanBeStrippedFromCook(StripReason);
+		Action->SetStrippedFromCook(bStripped);
+
+		UE_CLOG(bStripped, LogActorIO, Display, TEXT("%s - Stripped I/O action '%s' from cooked data: %s."), *GetPathName(), *Action->GetName(), *StripReason);
+	}
+}
+
+void UActorIOComponent::BuildActionData(bool bCooking)
+{
+	ActionData.Reset();
+	if (!bCooking || !UActorIOSettings::Get()->bStructBackedActions)
+	{
+		return;
+	}
+
+	for (const TObjectPtr<UActorIOAction>& ActionPtr : Actions)
+	{
+		UActorIOAction* Action = ActionPtr.Get();
+		if (Action && !Action->IsStrippedFromCook())
+		{
+			Action->CopyToActionData(ActionData.AddDefaulted_GetRef());
+			Action->SetStrippedFromCook(true);
+		}
+	}
+}
+
+void UActorIOComponent::PostCookSave()
+{
+	StripDeadActions(false);
+	BuildActionData(false);
+}
+#endif
+
+bool UActorIOComponent::IsOwnerBeingRemoved() const
+{
+	const AActor* ActionOwner = GetOwner();
+	if (!ActionOwner)
+	{
+		return false;
+	}
+
+	if (ActionOwner->IsActorBeingDestroyed())
+	{
+		return true;
+	}
+
+	// A streaming level that is only made invisible is removed from the world too, but it stays loaded and its actors stay alive.
+	// Their delegates would still execute our actions while the level is hidden, so they must be unbound one by one in that case.
+	const ULevel* OwnerLevel = ActionOwner->GetLevel();
+	if (OwnerLevel && OwnerLevel->bIsBeingRemoved)
+	{
+		const ULevelStreaming* StreamingLevel = ULevelStreaming::FindStreamingLevel(OwnerLevel);
+		if (!StreamingLevel || !StreamingLevel->ShouldBeLoaded())
+		{
+			return true;
+		}
+	}
+
+	const UWorld* World = GetWorld();
+	return World && World->bIsTearingDown;
+}
+
+void UActorIOComponent::SerializeToRawData(TArray<uint8>& RawData)
+{
+	FMemoryWriter Archive = FMemoryWriter(RawData);
+	FObjectAndNameAsStringProxyArchive ProxyArchive = FObjectAndNameAsStringProxyArchive(Archive, false);
+	ProxyArchive.ArIsSaveGame = true;
+
+	FBinaryArchiveFormatter Formatter = FBinaryArchiveFormatter(ProxyArchive);
+	FStructuredArchive StructuredArchive = FStructuredArchive(Formatter);
+
+	FStructuredArchive::FSlot RootSlot = StructuredArchive.Open();
+	Serialize(RootSlot.EnterRecord());
+}
+
+void UActorIOComponent::RestoreFromRawData(TArray<uint8>& RawData)
+{
+	FMemoryReader Archive = FMemoryReader(RawData);
+	FObjectAndNameAsStringProxyArchive ProxyArchive = FObjectAndNameAsStringProxyArchive(Archive, false);
+	ProxyArchive.ArIsSaveGame = true;
+
+	FBinaryArchiveFormatter Formatter = FBinaryArchiveFormatter(ProxyArchive);
+	FStructuredArchive StructuredArchive = FStructuredArchive(Formatter);
+
+	FStructuredArchive::FSlot RootSlot = StructuredArchive.Open();
+	Serialize(RootSlot.EnterRecord());
+}
+
+uint32 UActorIOComponent::GetActionLayoutHash() const
+{
+	if (ActionData.Num() == 0)
+	{
+		return GetActionLayoutHash(Actions);
+	}
+
+	// Plain data actions may not have an object yet, but the object would have the same name as in the data.
+	const int32 NumActions = Actions.Num();
+	uint32 LayoutHash = FCrc::MemCrc32(&NumActions, sizeof(NumActions));
+	for (int32 ActionIdx = 0; ActionIdx != NumActions; ++ActionIdx)
+	{
+		TStringBuilder<NAME_SIZE> ActionName;
+		if (UActorIOAction* Action = Actions[ActionIdx].Get())
+		{
+			Action->GetFName().AppendString(ActionName);
+		}
+		else if (IsDataAction(ActionIdx))
+		{
+			ActionData[ActionIdx].ActionName.AppendString(ActionName);
+		}
+
+		LayoutHash = FCrc::StrCrc32(ActionName.ToString(), LayoutHash);
+	}
+
+	return LayoutHash;
+}
+
+uint32 UActorIOComponent::GetActionLayoutHash(const TArray<TObjectPtr<UActorIOAction>>& InActions)
+{
+	const int32 NumActions = InActions.Num();
+	uint32 LayoutHash = FCrc::MemCrc32(&NumActions, sizeof(NumActions));
+	for (const TObjectPtr<UActorIOAction>& ActionPtr : InActions)
+	{
+		// Using the name as string so that the hash is the same between sessions.
+		TStringBuilder<NAME_SIZE> ActionName;
+		if (UActorIOAction* Action = ActionPtr.Get())
+		{
+			Action->GetFName().AppendString(ActionName);
+		}
+
+		LayoutHash = FCrc::StrCrc32(ActionName.ToString(), LayoutHash);
+	}
+
+	return LayoutHash;
+}
+
+void UActorIOComponent::GetExecutedStates(TBitArray<>& OutStates) const
+{
+	OutStates.Init(false, Actions.Num());
+	for (int32 ActionIdx = 0; ActionIdx != Actions.Num(); ++ActionIdx)
+	{
+		const UActorIOAction* Action = Actions[ActionIdx].Get();
+		if (Action && Action->GetWasExecuted())
+		{
+			OutStates[ActionIdx] = true;
+		}
+	}
+}
+
+void UActorIOComponent::RestoreExecutedStates(const TBitArray<>& InStates)
+{
+	check(InStates.Num() == Actions.Num());
+	for (int32 ActionIdx = 0; ActionIdx != Actions.Num(); ++ActionIdx)
+	{
+		// Plain data actions that were not executed don't need an object.
+		UActorIOAction* Action = InStates[ActionIdx] ? GetOrCreateAction(ActionIdx) : Actions[ActionIdx].Get();
+		if (Action)
+		{
+			Action->RestoreExecutedState(InStates[ActionIdx]);
+		}
+	}
+}
+
+void UActorIOComponent::GetExecutedActionIds(TArray<FGuid>& OutIds) const
+{
+	OutIds.Reset();
+	for (const TObjectPtr<UActorIOAction>& ActionPtr : Actions)
+	{
+		const UActorIOAction* Action = ActionPtr.Get();
+		if (Action && Action->GetWasExecuted() && Action->GetActionId().IsValid())
+		{
+			OutIds.Add(Action->GetActionId());
+		}
+	}
+}
+
+void UActorIOComponent::RestoreExecutedStatesById(TConstArrayView<FGuid> InExecutedIds)
+{
+	// Only a handful of actions are executed in most cases, so a linear search is faster than building a set.
+	for (int32 ActionIdx = 0; ActionIdx != Actions.Num(); ++ActionIdx)
+	{
+		// Plain data actions that were not executed don't need an object.
+		UActorIOAction* Action = Actions[ActionIdx].Get();
+		if (!Action && IsDataAction(ActionIdx) && ActionData[ActionIdx].ActionId.IsValid() && InExecutedIds.Contains(ActionData[ActionIdx].ActionId))
+		{
+			Action = CreateActionFromData(ActionIdx);
+		}
+
+		if (Action)
+		{
+			Action->RestoreExecutedState(Action->GetActionId().IsValid() && InExecutedIds.Contains(Action->GetActionId()));
+		}
+	}
+}
+
+void UActorIOComponent::UninitializeComponent()
+{
+	bBindingDeferred = false;
+	UnbindActions();
+
+	Super::UninitializeComponent();
+}
+
+void UActorIOComponent::Serialize(FStructuredArchive::FRecord Record)
+{
+	FArchive& UnderlyingArchive = Record.GetUnderlyingArchive();
+	if (UnderlyingArchive.IsSaveGame())
+	{
+		UnderlyingArchive.UsingCustomVersion(FActorIOActionVersion::GUID);
+
+		int32 Version = UnderlyingArchive.CustomVer(FActorIOActionVersion::GUID);
+		Record << SA_VALUE(TEXT("Version"), Version);
+
+		if (UnderlyingArchive.IsLoading())
+		{
+			UnderlyingArchive.SetCustomVersion(FActorIOActionVersion::GUID, Version, TEXT("ActorIOActionVer"));
+		}
+
+		bool bCompact = false;
+		uint32 LayoutHash = 0;
+
+		if (UnderlyingArchive.IsSaving())
+		{
+			// Executed states can only be saved by index if the action layout is the same as in the level.
+			// Otherwise the indices may point to different actions after the level is loaded again.
+			LayoutHash = GetActionLayoutHash();
+			bCompact = !InitialLayoutHash.IsSet() || InitialLayoutHash.GetValue() == LayoutHash;
+		}
+
+		if (Version >= FActorIOActionVersion::CompactExecutedState)
+		{
+			Record << SA_VALUE(TEXT("Compact"), bCompact);
+		}
+
+		if (bCompact)
+		{
+			int32 NumActions = 0;
+			TArray<uint8> ExecutedBits;
+			TArray<FGuid> ExecutedActionIds;
+
+			if (UnderlyingArchive.IsSaving())
+			{
+				TBitArray<> ExecutedStates;
+				GetExecutedStates(ExecutedStates);
+				GetExecutedActionIds(ExecutedActionIds);
+
+				NumActions = ExecutedStates.Num();
+				ExecutedBits.SetNumZeroed(FMath::DivideAndRoundUp(NumActions, 8));
+
+				for (TConstSetBitIterator<> It(ExecutedStates); It; ++It)
+				{
+					ExecutedBits[It.GetIndex() >> 3] |= 1 << (It.GetIndex() & 7);
+				}
+			}
+
+			Record << SA_VALUE(TEXT("LayoutHash"), LayoutHash);
+			Record << SA_VALUE(TEXT("NumActions"), NumActions);
+			Record << SA_VALUE(TEXT("ExecutedStates"), ExecutedBits);
+
+			// The ids of executed actions are saved next to the bitset, so that the states survive changes to the action layout.
+			if (Version >= FActorIOActionVersion::CompactExecutedActionIds)
+			{
+				Record << SA_VALUE(TEXT("ExecutedActionIds"), ExecutedActionIds);
+			}
+
+			if (UnderlyingArchive.IsLoading())
+			{
+				if (!ensureMsgf(NumActions >= 0 && ExecutedBits.Num() == FMath::DivideAndRoundUp(NumActions, 8), TEXT("%s - Executed states were malformed!"), *GetPathName()))
+				{
+					UnderlyingArchive.SetError();
+					return;
+				}
+
+				// Bits can't be matched with actions if the layout is different, e.g. the level was modified or re-cooked after the save was made.
+				// Fall back to the stable ids of the executed actions in that case, same as when applying world save data.
+				if (NumActions != Actions.Num() || LayoutHash != GetActionLayoutHash())
+				{
+					// Save data from before ids were saved has no ids, even if some actions were executed.
+					bool bAnyExecuted = false;
+					for (const uint8 ExecutedByte : ExecutedBits)
+					{
+						bAnyExecuted |= ExecutedByte != 0;
+					}
+
+					if (Version < FActorIOActionVersion::CompactExecutedActionIds || (bAnyExecuted && ExecutedActionIds.Num() == 0))
+					{
+						UE_LOG(LogActorIO, Warning, TEXT("%s - Action layout has changed since the game was saved. Executed states were not restored."), *GetPathName());
+						return;
+					}
+
+					UE_CLOG(DebugIOActions, LogActorIO, Log, TEXT("%s - Action layout has changed since the game was saved. Restoring executed states by action id."), *GetPathName());
+					RestoreExecutedStatesById(ExecutedActionIds);
+					return;
+				}
+
+				TBitArray<> ExecutedStates = TBitArray<>(false, NumActions);
+				for (int32 ActionIdx = 0; ActionIdx != NumActions; ++ActionIdx)
+				{
+					ExecutedStates[ActionIdx] = (ExecutedBits[ActionIdx >> 3] & (1 << (ActionIdx & 7))) != 0;
+				}
+
+				RestoreExecutedStates(ExecutedStates);
+			}
+		}
+		else
+		{
+			SerializeActionsByName(Record, Version);
+		}
+	}
+	else
+	{
+		// Use the default property serialization if not saving game data.
+		Super::Serialize(Record);
+	}
+}
+
+void UActorIOComponent::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+#if WITH_EDITOR
+	// Stripped actions are treated as editor only while the level is cooked.
+	// Must happen before the logic graph is compiled, since stripped actions are not part of it.
+	StripDeadActions(ObjectSaveContext.IsCooking());
+
+	// The logic graph only ever ends up in cooked packages.
+	if (ObjectSaveContext.IsCooking())
+	{
+		CompileLogicGraph();
+	}
+	else
+	{
+		LogicGraph.Reset();
+	}
+
+	// Must happen after the logic graph is compiled, since this marks the remaining actions as stripped too.
+	BuildActionData(ObjectSaveContext.IsCooking());
+#endif
+}
+
+bool UActorIOComponent::CanBeClusterRoot() const
+{
+	// The component and its actions are loaded and unloaded together with the level, and actions have no hard references to other objects.
+	// As a cluster, the garbage collector can mark all of them at once, instead of traversing every action.
+	// Opt-in, since actions removed at runtime can't be collected before the whole cluster is. @see CVarClusterIOComponents
+	return CVarClusterIOComponents.GetValueOnAnyThread() && !HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject | RF_Transient);
+}
+
+void UActorIOComponent::SerializeActionsByName(FStructuredArchive::FRecord Record, int32 Version)
+{
+	FArchive& UnderlyingArchive = Record.GetUnderlyingArchive();
+
+	// Actions with a stable id are looked up by id when loading, instead of searching for their name.
+	// Plain data actions are included without creating their object, since only the loaded ones are needed.
+	TMap<FGuid, int32> ActionIndicesById;
+	if (UnderlyingArchive.IsLoading() && Version >= FActorIOActionVersion::ActionIds)
+	{
+		ActionIndicesById.Reserve(Actions.Num());
+		for (int32 ActionIdx = 0; ActionIdx != Actions.Num(); ++ActionIdx)
+		{
+			const UActorIOAction* Action = Actions[ActionIdx].Get();
+			const FActorIOActionData* Data = GetActionData(ActionIdx);
+			const FGuid ActionId = Action ? Action->GetActionId() : (Data ? Data->ActionId : FGuid());
+			if (ActionId.IsValid())
+			{
+				ActionIndicesById.Add(ActionId, ActionIdx);
+			}
+		}
+	}
+
+	TArray<UActorIOAction*> SerializeActions;
+	if (UnderlyingArchive.IsSaving())
+	{
+		for (const TObjectPtr<UActorIOAction>& ActionPtr : Actions)
+		{
+			UActorIOAction* Action = ActionPtr.Get();
+			if (Action && Action->ShouldSerializeToArchive(UnderlyingArchive))
+			{
+				SerializeActions.Add(Action);
+			}
+		}
+	}
+
+	int32 NumActions = SerializeActions.Num();
+	FStructuredArchive::FMap ActionsMap = Record.EnterMap(TEXT("Actions"), NumActions);
+
+	for (int32 ActionIdx = 0; ActionIdx != NumActions; ++ActionIdx)
+	{
+		UActorIOAction* ActionPtr = nullptr;
+		FString ActionName;
+		FGuid ActionId;
+
+		if (UnderlyingArchive.IsSaving())
+		{
+			ActionPtr = SerializeActions[ActionIdx];
+			ActionName = ActionPtr->GetName();
+			ActionId = ActionPtr->GetActionId();
+		}
+
+		FStructuredArchive::FSlot ActionSlot = ActionsMap.EnterElement(ActionName);
+		FStructuredArchive::FRecord ActionRecord = ActionSlot.EnterRecord();
+
+		if (Version >= FActorIOActionVersion::ActionIds)
+		{
+			ActionRecord << SA_VALUE(TEXT("ActionId"), ActionId);
+		}
+
+		const int64 DataSizePosition = UnderlyingArchive.Tell();
+		int64 DataSize = 0;
+
+		// Pre-serialize the data size. We'll rewrite this after serializing the action.
+		if (!UnderlyingArchive.IsTextFormat())
+		{
+			ActionRecord << SA_VALUE(TEXT("DataSize"), DataSize);
+		}
+
+		const int64 BeginDataPosition = UnderlyingArchive.Tell();
+
+		if (UnderlyingArchive.IsLoading())
+		{
+			const int32* ActionIdxById = ActionId.IsValid() ? ActionIndicesById.Find(ActionId) : nullptr;
+			ActionPtr = ActionIdxById ? GetOrCreateAction(*ActionIdxById) : FindObjectFast<UActorIOAction>(this, *ActionName);
+
+			if (!ActionPtr && ActionData.Num() > 0)
+			{
+				const FName ActionFName = FName(*ActionName);
+				const int32 DataIdx = ActionData.IndexOfByPredicate([&ActionFName](const FActorIOActionData& Data)
+				{
+					return Data.ActionName == ActionFName;
+				});
+
+				ActionPtr = GetOrCreateAction(DataIdx);
+			}
+
+			UE_CLOG(!ActionPtr, LogActorIO, Warning, TEXT("%s - No action found with name '%s'."), *GetPathName(), *ActionName);
+
+			if (ActionPtr)
+			{
+				ActionPtr->Serialize(ActionRecord);
+			}
+			
+			// Seek to the end of the data block in case we serialized less.
+			if (!UnderlyingArchive.IsTextFormat())
+			{
+				if (!ensureMsgf(UnderlyingArchive.Tell() <= BeginDataPosition + DataSize, TEXT("%s - Serialized more data then expected when loading %s!"), *GetPathName(), *ActionName))
+				{
+					UnderlyingArchive.SetError();
+					return;
+				}
+
+				UnderlyingArchive.Seek(BeginDataPosition + DataSize);
+			}
+		}
+		else
+		{
+			check(ActionPtr);
+			ActionPtr->Serialize(ActionRecord);
+
+			// Seek back and re-write the data size with the actual size.
+			if (!UnderlyingArchive.IsTextFormat())
+			{
+				const int64 EndDataPosition = UnderlyingArchive.Tell();
+				DataSize = EndDataPosition - BeginDataPosition;
+
+				UnderlyingArchive.Seek(DataSizePosition);
+				UnderlyingArchive << DataSize;
+				UnderlyingArchive.Seek(EndDataPosition);
+			}
+		}
 	}
 }
 
@@ -0,0 +1,188 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "ActorIOLogicGraph.h"
+#include "ActorIOSubsystemBase.h"
+#include "ActorIORegistrationTable.h"
+#include "GameFramework/Actor.h"
+
+bool FActorIOGraphEvent::MakeEvent(AActor* InActor, FActorIOEvent& OutEvent) const
+{
+	UObject* DelegateOwner = InActor;
+	if (!DelegateSubobject.IsNone())
+	{
+		DelegateOwner = InActor->GetDefaultSubobjectByName(DelegateSubobject);
+		if (!DelegateOwner)
+		{
+			return false;
+		}
+	}
+
+	OutEvent.SetId(EventId);
+	switch (DelegateType)
+	{
+		case EActorIOGraphDelegateType::SparseDelegate:
+		{
+			OutEvent.SetSparseDelegate(DelegateOwner, DelegateName);
+			break;
+		}
+		case EActorIOGraphDelegateType::MulticastDelegate:
+		{
+			// Same delegate that the owner registers with SetMulticastDelegate, found through its property instead of by pointer.
+			const FMulticastInlineDelegateProperty* DelegateProperty = CastField<FMulticastInlineDelegateProperty>(DelegateOwner->GetClass()->FindPropertyByName(DelegateName));
+			if (!DelegateProperty)
+			{
+				return false;
+			}
+
+			OutEvent.SetMulticastDelegate(DelegateOwner, DelegateProperty->ContainerPtrToValuePtr<FMulticastScriptDelegate>(DelegateOwner));
+			break;
+		}
+		default:
+		{
+			OutEvent.SetBlueprintDelegate(DelegateOwner, DelegateName);
+			break;
+		}
+	}
+
+	switch (ProcessorOwner)
+	{
+		case EActorIOGraphProcessorOwner::DelegateOwner:
+		{
+			OutEvent.SetEventProcessor(DelegateOwner, EventProcessor);
+			break;
+		}
+		case EActorIOGraphProcessorOwner::Actor:
+		{
+			OutEvent.SetEventProcessor(InActor, EventProcessor);
+			break;
+		}
+		case EActorIOGraphProcessorOwner::Subsystem:
+		{
+			UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(InActor);
+			if (!IOSubsystem)
+			{
+				return false;
+			}
+
+			OutEvent.SetEventProcessor(IOSubsystem, EventProcessor);
+			break;
+		}
+		default:
+		{
+			break;
+		}
+	}
+
+	return true;
+}
+
+#if WITH_EDITOR
+bool FActorIOGraphEvent::Compile(const FActorIOEvent& InEvent, AActor* InActor, FActorIOGraphEvent& OutEvent)
+{
+	// Only delegates that can be found again by name are supported.
+	// Multicast delegates are registered by pointer, so they are looked up by the delegate property that holds them.
+	UObject* DelegateOwner = InEvent.DelegateOwner.Get();
+	if (!DelegateOwner)
+	{
+		return false;
+	}
+
+	OutEvent.EventId = InEvent.EventId;
+	switch (InEvent.DelegateType)
+	{
+		case FActorIOEvent::Type::SparseDelegate:
+		{
+			OutEvent.DelegateType = EActorIOGraphDelegateType::SparseDelegate;
+			OutEvent.DelegateName = InEvent.SparseDelegateName;
+			break;
+		}
+		case FActorIOEvent::Type::BlueprintDelegate:
+		{
+			OutEvent.DelegateType = EActorIOGraphDelegateType::BlueprintDelegate;
+			OutEvent.DelegateName = InEvent.BlueprintDelegateName;
+			break;
+		}
+		case FActorIOEvent::Type::MulticastDelegate:
+		{
+			OutEvent.DelegateType = EActorIOGraphDelegateType::MulticastDelegate;
+			OutEvent.DelegateName = NAME_None;
+			for (TFieldIterator<FMulticastInlineDelegateProperty> It(DelegateOwner->GetClass()); It; ++It)
+			{
+				if (It->ContainerPtrToValuePtr<FMulticastScriptDelegate>(DelegateOwner) == InEvent.MulticastDelegatePtr)
+				{
+					OutEvent.DelegateName = It->GetFName();
+					break;
+				}
+			}
+
+			if (OutEvent.DelegateName.IsNone())
+			{
+				return false;
+			}
+
+			break;
+		}
+		default:
+		{
+			return false;
+		}
+	}
+
+	if (DelegateOwner == InActor)
+	{
+		OutEvent.DelegateSubobject = NAME_None;
+	}
+	else if (DelegateOwner->GetOuter() == InActor && DelegateOwner->IsDefaultSubobject())
+	{
+		OutEvent.DelegateSubobject = DelegateOwner->GetFName();
+	}
+	else
+	{
+		return false;
+	}
+
+	const UObject* ProcessorObject = InEvent.EventProcessor.GetUObject();
+	OutEvent.EventProcessor = InEvent.EventProcessor.GetFunctionName();
+
+	if (OutEvent.EventProcessor.IsNone())
+	{
+		OutEvent.ProcessorOwner = EActorIOGraphProcessorOwner::None;
+	}
+	else if (ProcessorObject == DelegateOwner)
+	{
+		OutEvent.ProcessorOwner = EActorIOGraphProcessorOwner::DelegateOwner;
+	}
+	else if (ProcessorObject == InActor)
+	{
+		OutEvent.ProcessorOwner = EActorIOGraphProcessorOwner::Actor;
+	}
+	else if (ProcessorObject && ProcessorObject->IsA<UActorIOSubsystemBase>())
+	{
+		OutEvent.ProcessorOwner = EActorIOGraphProcessorOwner::Subsystem;
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool FActorIOGraphEvent::CompileRegistered(const FActorIORegisteredEvent& InEvent, AActor* InActor, FActorIOGraphEvent& OutEvent)
+{
+	if (!InEvent.DelegateSubobject.IsNone() && !InActor->GetDefaultSubobjectByName(InEvent.DelegateSubobject))
+	{
+		return false;
+	}
+
+	OutEvent.EventId = InEvent.EventId;
+	OutEvent.DelegateType = InEvent.DelegateType == EActorIORegisteredDelegateType::SparseDelegate ? EActorIOGraphDelegateType::SparseDelegate : EActorIOGraphDelegateType::BlueprintDelegate;
+	OutEvent.DelegateName = InEvent.DelegateName;
+	OutEvent.DelegateSubobject = InEvent.DelegateSubobject;
+
+	// Same as UActorIOSubsystemBase::RegisterNativeEventsForObject, the event processor is a function of the subsystem.
+	OutEvent.EventProcessor = InEvent.EventProcessor;
+	OutEvent.ProcessorOwner = InEvent.EventProcessor.IsNone() ? EActorIOGraphProcessorOwner::None : EActorIOGraphProcessorOwner::Subsystem;
+	return true;
+}
+#endif
@@ -7,6 +7,11 @@ UActorIOSettings::UActorIOSettings()
 {
 	ActorIOSubsystemClass = UActorIOSubsystemBase::StaticClass();
 	LevelActivationMethod = ELevelActivationMethod::Automatic;
+	bTimeSlicedBinding = false;
+	BindingTimeBudgetMs = 2.0f;
+	bCollapseRelayChains = false;
+	bStripDeadActionsOnCook = true;
+	bStructBackedActions = false;
 }
 
 const UActorIOSettings* UActorIOSettings::Get()
@@ -6,7 +6,9 @@
 #include "ActorIOAction.h"
 #include "ActorIOSettings.h"
 #include "ActorIOVersions.h"
+#include "ActorIOArgumentImporter.h"
 #include "LogicActors/LogicActorBase.h"
+#include "LogicActors/LogicRelay.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/CameraBlockingVolume.h"
@@ -19,6 +21,7 @@
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Engine/Level.h"
+#include "Engine/GameInstance.h"
 #include "Particles/Emitter.h"
 #include "Sound/AmbientSound.h"
 #include "Sound/AudioVolume.h"
@@ -27,6 +30,8 @@
 #include "Serialization/MemoryReader.h"
 #include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 #include "Serialization/Formatters/BinaryArchiveFormatter.h"
+#include "Misc/Compression.h"
+#include "Async/Async.h"
 #include "Misc/EngineVersionComparison.h"
 
 #if UE_VERSION_NEWER_THAN(5, 6, ENGINE_PATCH_VERSION)
@@ -40,6 +45,11 @@ UActorIOSubsystemBase::UActorIOSubsystemBase()
     ActiveLevels = TArray<TWeakObjectPtr<ULevel>>();
     PendingMessages = TArray<FActorIOMessage>();
     ActionExecContext = FActionExecutionContext();
+    CachedGlobalNamedArguments = TMap<FString, FString>();
+    CachedGlobalObjectArguments = TMap<FString, TWeakObjectPtr<UObject>>();
+    CachedGlobalNamedArgumentsFrame = 0;
+    CommandObjectArguments = nullptr;
+    bHasCachedGlobalNamedArguments = false;
 }
 
 UActorIOSubsystemBase* UActorIOSubsystemBase::Get(UObject* WorldContextObject)
@@ -93,8 +103,13 @@ void UActorIOSubsystemBase::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
+    BuildRegistrationTable(RegisteredEvents, RegisteredFunctions);
+
     if (GetWorld()->IsGameWorld())
     {
+        const UActorIOSettings* IOSettings = UActorIOSettings::Get();
+        ClassRegistry = IOSettings->ClassRegistry.LoadSynchronous();
+
         DelegateHandle_OnLevelAdded = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ThisClass::OnLevelAddedToWorld);
         DelegateHandle_OnLevelRemoved = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ThisClass::OnLevelRemovedFromWorld);
     }
@@ -106,6 +121,18 @@ void UActorIOSubsystemBase::Deinitialize()
 
     FWorldDelegates::LevelAddedToWorld.Remove(DelegateHandle_OnLevelAdded);
     FWorldDelegates::LevelRemovedFromWorld.Remove(DelegateHandle_OnLevelRemoved);
+
+    if (UGameInstance* GameInstance = GetWorld()->GetGameInstance())
+    {
+        GameInstance->GetOnPawnControllerChanged().RemoveDynamic(this, &ThisClass::OnPawnControllerChanged);
+    }
+
+    PendingLevelBindings.Reset();
+    SubobjectCache.Reset();
+    ClassRegistrationCache.Reset();
+    ClassRegistry = nullptr;
+    ActionRegistry.Reset();
+    InvalidateGlobalNamedArguments();
 }
 
 void UActorIOSubsystemBase::OnWorldBeginPlay(UWorld& InWorld)
@@ -114,6 +141,12 @@ void UActorIOSubsystemBase::OnWorldBeginPlay(UWorld& InWorld)
 
     if (InWorld.IsGameWorld())
     {
+        // Cached global named arguments may refer to the possessed pawn.
+        if (UGameInstance* GameInstance = InWorld.GetGameInstance())
+        {
+            GameInstance->GetOnPawnControllerChanged().AddUniqueDynamic(this, &ThisClass::OnPawnControllerChanged);
+        }
+
         const UActorIOSettings* IOSettings = UActorIOSettings::Get();
         if (IOSettings->LevelActivationMethod == ELevelActivationMethod::Automatic)
         {
@@ -126,12 +159,17 @@ void UActorIOSubsystemBase::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
+    if (PendingLevelBindings.Num() > 0)
+    {
+        TickPendingBindings();
+    }
+
     TickPendingMessages(DeltaTime);
 }
 
 bool UActorIOSubsystemBase::IsTickable() const
 {
-    return PendingMessages.Num() > 0;
+    return PendingMessages.Num() > 0 || PendingLevelBindings.Num() > 0;
 }
 
 TStatId UActorIOSubsystemBase::GetStatId() const
@@ -146,6 +184,10 @@ void UActorIOSubsystemBase::ActivateLevel(ULevel* InLevel)
         return;
     }
 
+    // Make sure that all actions of the level are bound before it is activated.
+    // Otherwise the level could send and receive messages with some of its actions still unbound.
+    FlushPendingBindings(InLevel);
+
     CompactActiveLevels();
     ActiveLevels.Emplace(InLevel);
 
@@ -261,6 +303,137 @@ FSoftObjectPath UActorIOSubsystemBase::GetLevelPathFromObjectPath(const FSoftObj
     return OutPath;
 }
 
+bool UActorIOSubsystemBase::ShouldDeferBinding(UActorIOComponent* InComponent) const
+{
+    const UActorIOSettings* IOSettings = UActorIOSettings::Get();
+    if (!IOSettings->bTimeSlicedBinding)
+    {
+        return false;
+    }
+
+    UWorld* MyWorld = GetWorld();
+    if (!MyWorld || !MyWorld->IsGameWorld() || !MyWorld->HasBegunPlay())
+    {
+        // Levels loaded together with the world are bound immediately.
+        return false;
+    }
+
+    // Only defer binding for levels that are being streamed in.
+    // Actors spawned into levels that are already active are bound immediately.
+    ULevel* ComponentLevel = InComponent->GetComponentLevel();
+    return ComponentLevel && ComponentLevel != MyWorld->PersistentLevel && !IsLevelActive(ComponentLevel);
+}
+
+void UActorIOSubsystemBase::QueueComponentBinding(UActorIOComponent* InComponent)
+{
+    ULevel* ComponentLevel = InComponent->GetComponentLevel();
+    check(ComponentLevel);
+
+    FPendingLevelBinding* LevelBinding = PendingLevelBindings.FindByPredicate([ComponentLevel](const FPendingLevelBinding& Element)
+    {
+        return Element.Level.Get() == ComponentLevel;
+    });
+
+    if (!LevelBinding)
+    {
+        LevelBinding = &PendingLevelBindings.AddDefaulted_GetRef();
+        LevelBinding->Level = ComponentLevel;
+    }
+
+    LevelBinding->Components.Emplace(InComponent);
+}
+
+void UActorIOSubsystemBase::FlushPendingBindings(ULevel* InLevel)
+{
+    const int32 BindingIdx = PendingLevelBindings.IndexOfByPredicate([InLevel](const FPendingLevelBinding& Element)
+    {
+        return Element.Level.Get() == InLevel;
+    });
+
+    if (BindingIdx != INDEX_NONE)
+    {
+        // Remove the entry before binding, in case binding leads back into level activation.
+        FPendingLevelBinding LevelBinding = MoveTemp(PendingLevelBindings[BindingIdx]);
+        PendingLevelBindings.RemoveAt(BindingIdx);
+
+        BindRemainingComponents(LevelBinding);
+    }
+}
+
+void UActorIOSubsystemBase::TickPendingBindings()
+{
+    const UActorIOSettings* IOSettings = UActorIOSettings::Get();
+    const double EndTime = FPlatformTime::Seconds() + IOSettings->BindingTimeBudgetMs / 1000.0;
+
+    // Bind levels in the order they were added to the world.
+    // The budget is checked after every component, so a single component with lots of actions may exceed it.
+    while (PendingLevelBindings.Num() > 0)
+    {
+        FPendingLevelBinding& LevelBinding = PendingLevelBindings[0];
+        BindRemainingComponents(LevelBinding, EndTime);
+
+        if (LevelBinding.NextComponentIdx < LevelBinding.Components.Num())
+        {
+            // Ran out of time for this frame.
+            break;
+        }
+
+        ULevel* Level = LevelBinding.Level.Get();
+        const bool bActivateLevel = LevelBinding.bActivateWhenDone;
+        PendingLevelBindings.RemoveAt(0);
+
+        if (Level && bActivateLevel)
+        {
+            ActivateLevel(Level);
+        }
+
+        if (FPlatformTime::Seconds() >= EndTime)
+        {
+            break;
+        }
+    }
+}
+
+void UActorIOSubsystemBase::BindRemainingComponents(FPendingLevelBinding& InBinding, double EndTime)
+{
+    while (InBinding.NextComponentIdx < InBinding.Components.Num())
+    {
+        UActorIOComponent* IOComponent = InBinding.Components[InBinding.NextComponentIdx].Get();
+        InBinding.NextComponentIdx++;
+
+        // Skip components that were destroyed or uninitialized while waiting.
+        // Components whose actor has begun play in the meantime are already bound.
+        if (IsValid(IOComponent) && IOComponent->HasBeenInitialized())
+        {
+            IOComponent->BindDeferredActions();
+        }
+
+        if (EndTime > 0.0 && FPlatformTime::Seconds() >= EndTime)
+        {
+            break;
+        }
+    }
+}
+
+bool UActorIOSubsystemBase::IsObjectPathInLevel(const FSoftObjectPath& InObjectPath, const FSoftObjectPath& InLevelPath)
+{
+    // Objects in different packages can never be in the same level.
+    // Comparing the asset paths first is cheap, and filters out almost every message from other levels without touching strings.
+    if (InObjectPath.GetAssetPath() != InLevelPath.GetAssetPath())
+    {
+        return false;
+    }
+
+    // The subobject path is: Sublevel.Path.To.Object
+    // The object is in the level if the subobject path starts with the level's subobject path, followed by a dot.
+    const FString& ObjectSubPath = InObjectPath.GetSubPathString();
+    const FString& LevelSubPath = InLevelPath.GetSubPathString();
+
+    return ObjectSubPath.Len() > LevelSubPath.Len()
+        && ObjectSubPath[LevelSubPath.Len()] == '.'
+        && ObjectSubPath.StartsWith(LevelSubPath, ESearchCase::CaseSensitive);
+}
+
 void UActorIOSubsystemBase::QueueMessage(FActorIOMessage& InMessage)
 {
     if (InMessage.TimeRemaining <= 0.0f)
@@ -276,6 +449,15 @@ void UActorIOSubsystemBase::QueueMessage(FActorIOMessage& InMessage)
     PendingMessages.Add(InMessage);
 }
 
+void UActorIOSubsystemBase::ProcessDirectRelayTrigger(const UActorIOAction* InSender, ALogicRelay* InRelay)
+{
+    check(InRelay);
+
+    // Logged the same way as the final command of a message, so that collapsed hops still show up in the command log.
+    UE_CLOG(LogIOFinalCommand, LogActorIO, Log, TEXT("Executing command: \"Trigger\" (Target: %s, Direct)"), *InRelay->GetName());
+    InRelay->Trigger();
+}
+
 void UActorIOSubsystemBase::RemovePendingMessages(UActorIOAction* InAction)
 {
     if (!InAction)
@@ -283,17 +465,25 @@ void UActorIOSubsystemBase::RemovePendingMessages(UActorIOAction* InAction)
         return;
     }
 
-    for (int32 MessageIdx = PendingMessages.Num() - 1; MessageIdx >= 0; --MessageIdx)
+    // Comparing the stable ids of actions if possible, so that soft pointers of messages restored from save files don't need to be resolved.
+    // Ids are only unique within a level though. A level instance that is loaded multiple times has the same ids in every instance.
+    // So the path of the sender must also be in the level of the action, which is a cheap check that doesn't resolve anything.
+    // Otherwise not comparing paths because we have a pointer to the I/O action.
+    // Since messages are sent by I/O actions, we know that the soft pointer of the relevant messages are valid.
+    // Using RemoveAll so that the list is compacted in a single pass, instead of shifting elements for every removed message.
+    const FGuid& ActionId = InAction->GetActionId();
+    const AActor* ActionOwner = InAction->GetOwnerActor();
+    const FSoftObjectPath ActionLevelPath = ActionId.IsValid() && ActionOwner ? FSoftObjectPath(ActionOwner->GetLevel()) : FSoftObjectPath();
+
+    PendingMessages.RemoveAll([InAction, &ActionId, &ActionLevelPath](const FActorIOMessage& Message)
     {
-        // Not comparing paths in this case because we have a pointer to the I/O action.
-        // Since messages are sent by I/O actions, we know that the soft pointer of the relevant messages are valid.
-
-        const FActorIOMessage& Message = PendingMessages[MessageIdx];
-        if (Message.SenderPtr.Get() == InAction)
+        if (Message.SenderId.IsValid() && ActionLevelPath.IsValid())
         {
-            PendingMessages.RemoveAt(MessageIdx);
+            return Message.SenderId == ActionId && IsObjectPathInLevel(Message.SenderPtr.ToSoftObjectPath(), ActionLevelPath);
         }
-    }
+
+        return Message.SenderPtr.Get() == InAction;
+    });
 }
 
 void UActorIOSubsystemBase::RemovePendingMessages(ULevel* InLevel)
@@ -304,22 +494,18 @@ void UActorIOSubsystemBase::RemovePendingMessages(ULevel* InLevel)
     }
 
     const FSoftObjectPath LevelPath = InLevel->GetPathName();
-    for (int32 MessageIdx = PendingMessages.Num() - 1; MessageIdx >= 0; --MessageIdx)
+    PendingMessages.RemoveAll([&LevelPath](const FActorIOMessage& Message)
     {
-        const FActorIOMessage& Message = PendingMessages[MessageIdx];
-        const FSoftObjectPath SenderLevelPath = GetLevelPathFromObjectPath(Message.SenderPtr.ToSoftObjectPath());
-        if (SenderLevelPath == LevelPath)
-        {
-            PendingMessages.RemoveAt(MessageIdx);
-        }
-    }
+        return IsObjectPathInLevel(Message.SenderPtr.ToSoftObjectPath(), LevelPath);
+    });
 }
 
 void UActorIOSubsystemBase::TickPendingMessages(float DeltaTime)
 {
-    TArray<int32> MessagesProcessed = TArray<int32>();
+    bool bAnyMessageProcessed = false;
 
     // Tick pending messages in sequence.
+    // Messages queued while ticking are appended to the list, so they are ticked in the same pass.
     for (int32 MessageIdx = 0; MessageIdx != PendingMessages.Num(); ++MessageIdx)
     {
         FActorIOMessage& Message = PendingMessages[MessageIdx];
@@ -334,14 +520,21 @@ void UActorIOSubsystemBase::TickPendingMessages(float DeltaTime)
         if (Message.TimeRemaining <= 0.0f)
         {
             ProcessMessage(Message);
-            MessagesProcessed.Add(MessageIdx);
+
+            // Not using the reference from above since processing the message may have queued new messages, reallocating the list.
+            PendingMessages[MessageIdx].MessageFlags |= static_cast<uint8>(FActorIOMessage::EMessageFlags::IsProcessed);
+            bAnyMessageProcessed = true;
         }
     }
 
     // Now remove all pending messages that were processed (activated).
-    for (int32 ProcessedMessageIdx = MessagesProcessed.Num() - 1; ProcessedMessageIdx >= 0; --ProcessedMessageIdx)
+    // Done in a single pass so that the cost stays linear regardless of how many messages were processed.
+    if (bAnyMessageProcessed)
     {
-        PendingMessages.RemoveAt(MessagesProcessed[ProcessedMessageIdx]);
+        PendingMessages.RemoveAll([](const FActorIOMessage& Message)
+        {
+            return (Message.MessageFlags & static_cast<uint8>(FActorIOMessage::EMessageFlags::IsProcessed)) != 0;
+        });
     }
 }
 
@@ -401,7 +594,7 @@ void UActorIOSubsystemBase::ProcessMessage(const FActorIOMessage& InMessage)
     UObject* TargetObject = ActorPtr;
     if (!TargetFunction->TargetSubobject.IsNone())
     {
-        TargetObject = ActorPtr->GetDefaultSubobjectByName(TargetFunction->TargetSubobject);
+        TargetObject = FindTargetSubobject(ActorPtr, TargetFunction->TargetSubobject);
         if (!TargetObject)
         {
             IActorIO::ExecutionError(DebugIOActions, ELogVerbosity::Error, FString::Printf(TEXT("I/O function '%s' target subobject '%s' not found on actor '%s'."), *InMessage.FunctionId.ToString(), *TargetFunction->TargetSubobject.ToString(), *ActorPtr->GetActorNameOrLabel()));
@@ -430,7 +623,10 @@ void UActorIOSubsystemBase::ProcessMessage(const FActorIOMessage& InMessage)
     // Format is: FunctionName Arg1 Arg2 Arg3 (...)
     FString Command = FunctionName + InMessage.Arguments;
 
-    UE_CLOG(LogIOFinalCommand, LogActorIO, Log, TEXT("Executing command: %s (Target: %s)"), *Command, *TargetObject->GetName());
+    UE_CLOG(LogIOFinalCommand, LogActorIO, Log, TEXT("Executing command: %s (Target: %s)"), *FActorIOMessage::ResolveObjectArguments(Command, InMessage.ObjectArguments), *TargetObject->GetName());
+
+    // Let the command find the objects of typed object arguments.
+    TGuardValue<const TArray<TWeakObjectPtr<UObject>>*> ObjectArgumentsGuard(CommandObjectArguments, &InMessage.ObjectArguments);
 
     FStringOutputDevice Ar;
     ExecuteCommand(TargetObject, *Command, Ar, this);
@@ -442,6 +638,37 @@ void UActorIOSubsystemBase::ProcessMessage(const FActorIOMessage& InMessage)
     }
 }
 
+UObject* UActorIOSubsystemBase::FindTargetSubobject(AActor* InActor, FName InSubobjectName)
+{
+    if (!InActor || InSubobjectName.IsNone())
+    {
+        return nullptr;
+    }
+
+    const TPair<TObjectKey<AActor>, FName> CacheKey = TPair<TObjectKey<AActor>, FName>(InActor, InSubobjectName);
+    if (const TWeakObjectPtr<UObject>* CachedSubobject = SubobjectCache.Find(CacheKey))
+    {
+        if (UObject* Subobject = CachedSubobject->Get())
+        {
+            return Subobject;
+        }
+    }
+
+    // Only found subobjects are cached, and stale entries are removed when they are looked up.
+    // Otherwise the cache would keep growing with actors that are spawned and destroyed in the persistent level.
+    UObject* Subobject = InActor->GetDefaultSubobjectByName(InSubobjectName);
+    if (Subobject)
+    {
+        SubobjectCache.Add(CacheKey, Subobject);
+    }
+    else
+    {
+        SubobjectCache.Remove(CacheKey);
+    }
+
+    return Subobject;
+}
+
 bool UActorIOSubsystemBase::ExecuteCommand(UObject* Target, const TCHAR* Str, FOutputDevice& Ar, UObject* Executor)
 {
     /**
@@ -457,6 +684,8 @@ bool UActorIOSubsystemBase::ExecuteCommand(UObject* Target, const TCHAR* Str, FO
      *   - Use Ar.Logf instead of UE_LOG(LogScriptCore) because LogScriptCore is static therefore its verbosity cannot be changed.
      *   - Skip importing value for 'out' properties that are not passed by 'ref'.
      *   - Skip CPP param default value initialization because it only works in editor and not packaged games.
+     *   - Pass typed object arguments to object params as pointers, and as paths to other params.
+     *   - Import common param types with specialized importers. See FActorIOArgumentImporter.
      *   - Return success/failure properly.
      */
 
@@ -556,6 +785,41 @@ bool UActorIOSubsystemBase::ExecuteCommand(UObject* Target, const TCHAR* Str, FO
         FString ArgStr;
         FParse::Token(Str, ArgStr, true);
 
+        // Typed object arguments go straight into object params, without searching for the object by path.
+        if (CommandObjectArguments && ArgStr.StartsWith(OBJECTARGUMENT_PREFIX))
+        {
+            const int32 SlotIdx = FCString::Atoi(*ArgStr + 1);
+            UObject* ArgObject = CommandObjectArguments->IsValidIndex(SlotIdx) ? (*CommandObjectArguments)[SlotIdx].Get() : nullptr;
+
+            FObjectPropertyBase* ObjectParam = CastField<FObjectPropertyBase>(PropertyParam);
+            bool bCanAssignObject = ObjectParam && (!ArgObject || ArgObject->IsA(ObjectParam->PropertyClass));
+
+            // Class params only accept subclasses of their meta class, same as when the class is imported from its path.
+            if (bCanAssignObject && ArgObject)
+            {
+                const UClass* MetaClass = nullptr;
+                if (const FClassProperty* ClassParam = CastField<FClassProperty>(PropertyParam))
+                {
+                    MetaClass = ClassParam->MetaClass;
+                }
+                else if (const FSoftClassProperty* SoftClassParam = CastField<FSoftClassProperty>(PropertyParam))
+                {
+                    MetaClass = SoftClassParam->MetaClass;
+                }
+
+                const UClass* ArgClass = Cast<UClass>(ArgObject);
+                bCanAssignObject = !MetaClass || (ArgClass && ArgClass->IsChildOf(MetaClass));
+            }
+
+            if (bCanAssignObject)
+            {
+                ObjectParam->SetObjectPropertyValue_InContainer(Parms, ArgObject);
+                continue;
+            }
+
+            ArgStr = FActorIOMessage::ResolveObjectArguments(ArgStr, *CommandObjectArguments);
+        }
+
         // if ArgStr is empty but we have more params to read parse the function to see if these have defaults, if so set them
         bool bFoundDefault = false;
         bool bFailedImport = true;
@@ -592,10 +856,22 @@ bool UActorIOSubsystemBase::ExecuteCommand(UObject* Target, const TCHAR* Str, FO
             if (PropertyParam == LastParameter && PropertyParam->IsA<FStrProperty>() && FCString::Strcmp(Str, TEXT("")) != 0)
             {
                 ArgStr = FString(RemainingStr).TrimStart();
+                if (CommandObjectArguments)
+                {
+                    ArgStr = FActorIOMessage::ResolveObjectArguments(ArgStr, *CommandObjectArguments);
+                }
             }
 
-            const TCHAR* Result = It->ImportText_InContainer(*ArgStr, Parms, nullptr, ExportFlags);
-            bFailedImport = (Result == nullptr);
+            // Common parameter types are imported without going through the generic property text importer.
+            if (CVarFastArgumentImport.GetValueOnGameThread() && FActorIOArgumentImporter::TryImport(PropertyParam, ArgStr, Parms))
+            {
+                bFailedImport = false;
+            }
+            else
+            {
+                const TCHAR* Result = It->ImportText_InContainer(*ArgStr, Parms, nullptr, ExportFlags);
+                bFailedImport = (Result == nullptr);
+            }
         }
 
         if (bFailedImport)
@@ -651,458 +927,1146 @@ void UActorIOSubsystemBase::RestoreFromRawData(TArray<uint8>& RawData)
     Serialize(RootSlot.EnterRecord());
 }
 
-void UActorIOSubsystemBase::Serialize(FStructuredArchive::FRecord Record)
+void UActorIOSubsystemBase::CaptureSaveData(FActorIOWorldSaveData& OutSaveData, ULevel* InLevel)
 {
-    Super::Serialize(Record);
-
-    FArchive& UnderlyingArchive = Record.GetUnderlyingArchive();
-    if (UnderlyingArchive.IsSaveGame())
-    {
-        UnderlyingArchive.UsingCustomVersion(FActorIOSubsystemVersion::GUID);
-
-        int32 Version = UnderlyingArchive.CustomVer(FActorIOSubsystemVersion::GUID);
-        Record << SA_VALUE(TEXT("Version"), Version);
+    check(IsInGameThread());
 
-        if (UnderlyingArchive.IsLoading())
-        {
-            UnderlyingArchive.SetCustomVersion(FActorIOSubsystemVersion::GUID, Version, TEXT("ActorIOSubsystemVer"));
-        }
+    OutSaveData.Levels.Reset();
+    OutSaveData.PendingMessages.Reset();
 
-        TArray<FActorIOMessage> Messages;
-        int32 NumMessages = 0;
+    UWorld* MyWorld = GetWorld();
+    if (!MyWorld)
+    {
+        return;
+    }
 
-        if (UnderlyingArchive.IsSaving())
+    const TArray<ULevel*>& WorldLevels = MyWorld->GetLevels();
+    for (ULevel* Level : WorldLevels)
+    {
+        if (!Level || (InLevel && Level != InLevel))
         {
-            Messages = PendingMessages;
-            NumMessages = PendingMessages.Num();
+            continue;
         }
 
-        FStructuredArchive::FArray MessageArray = Record.EnterArray(TEXT("PendingMessages"), NumMessages);
+        FActorIOLevelSaveData& LevelData = OutSaveData.Levels.AddDefaulted_GetRef();
+        LevelData.LevelPath = UWorld::RemovePIEPrefix(Level->GetPathName());
 
-        if (UnderlyingArchive.IsLoading())
-        {
-            PendingMessages.Reset(NumMessages);
-        }
+        // Save properties of every logic actor in the level go into the same block of memory.
+        // This way the archives only need to be set up once per level.
+        FMemoryWriter PropertyWriter = FMemoryWriter(LevelData.PropertyData);
+        FObjectAndNameAsStringProxyArchive PropertyArchive = FObjectAndNameAsStringProxyArchive(PropertyWriter, false);
+        PropertyArchive.ArIsSaveGame = true;
 
-        for (int32 MessageIdx = 0; MessageIdx != NumMessages; ++MessageIdx)
+        for (AActor* Actor : Level->Actors)
         {
-            FStructuredArchive::FSlot MessageSlot = MessageArray.EnterElement();
-            FStructuredArchive::FRecord MessageRecord = MessageSlot.EnterRecord();
-
-            const int64 DataSizePosition = UnderlyingArchive.Tell();
-            int64 DataSize = 0;
-
-            // Pre-serialize the data size. We'll rewrite this after serializing the action.
-            if (!UnderlyingArchive.IsTextFormat())
+            if (!IsValid(Actor))
             {
-                MessageRecord << SA_VALUE(TEXT("DataSize"), DataSize);
+                continue;
             }
 
-            const int64 BeginDataPosition = UnderlyingArchive.Tell();
-
-            if (UnderlyingArchive.IsLoading())
+            UActorIOComponent* IOComponent = Actor->FindComponentByClass<UActorIOComponent>();
+            ALogicActorBase* LogicActor = Cast<ALogicActorBase>(Actor);
+            if (!IOComponent && !LogicActor)
             {
-                FActorIOMessage& Message = Messages.AddDefaulted_GetRef();
-                Message.SerializeMessage(MessageRecord);
+                continue;
+            }
 
-                if (!UnderlyingArchive.IsTextFormat())
-                {
-                    if (!ensureMsgf(UnderlyingArchive.Tell() <= BeginDataPosition + DataSize, TEXT("Serialized more data then expected when loading PendingMessages of I/O subsystem!")))
-                    {
-                        UnderlyingArchive.SetError();
-                        return;
-                    }
+            FActorIOActorSaveData& ActorData = LevelData.Actors.AddDefaulted_GetRef();
+            ActorData.ActorName = Actor->GetFName();
 
-                    UnderlyingArchive.Seek(BeginDataPosition + DataSize);
-                }
+            if (IOComponent)
+            {
+                ActorData.LayoutHash = IOComponent->GetActionLayoutHash();
+                IOComponent->GetExecutedStates(ActorData.ExecutedStates);
+                IOComponent->GetExecutedActionIds(ActorData.ExecutedActionIds);
             }
-            else
+
+            if (LogicActor)
             {
-                FActorIOMessage& Message = Messages[MessageIdx];
-                Message.SerializeMessage(MessageRecord);
+                ActorData.PropertyOffset = static_cast<int32>(PropertyArchive.Tell());
 
-                // Seek back and re-write the data size with the actual size.
-                if (!UnderlyingArchive.IsTextFormat())
-                {
-                    const int64 EndDataPosition = UnderlyingArchive.Tell();
-                    DataSize = EndDataPosition - BeginDataPosition;
+                LogicActor->PreSerializeLogicActor(PropertyArchive);
+                LogicActor->SerializeScriptProperties(PropertyArchive);
+                LogicActor->PostSerializeLogicActor(PropertyArchive);
 
-                    UnderlyingArchive.Seek(DataSizePosition);
-                    UnderlyingArchive << DataSize;
-                    UnderlyingArchive.Seek(EndDataPosition);
-                }
+                ActorData.PropertySize = static_cast<int32>(PropertyArchive.Tell()) - ActorData.PropertyOffset;
             }
         }
+    }
 
-        // Now queue all loaded messages.
-        if (UnderlyingArchive.IsLoading())
+    if (InLevel)
+    {
+        const FSoftObjectPath LevelPath = FSoftObjectPath(InLevel);
+        for (const FActorIOMessage& Message : PendingMessages)
         {
-            for (FActorIOMessage& LoadedMessage : Messages)
+            if (IsObjectPathInLevel(Message.SenderPtr.ToSoftObjectPath(), LevelPath))
             {
-                QueueMessage(LoadedMessage);
+                OutSaveData.PendingMessages.Add(Message);
             }
         }
     }
-}
-
-void UActorIOSubsystemBase::OnLevelAddedToWorld(ULevel* InLevel, UWorld* InWorld)
-{
-    if (InWorld != GetWorld())
+    else
     {
-        // Do nothing if the level was not added to our world (e.g. other PIE sessions).
-        return;
+        OutSaveData.PendingMessages = PendingMessages;
     }
 
-    const UActorIOSettings* IOSettings = UActorIOSettings::Get();
-    if (IOSettings->LevelActivationMethod == ELevelActivationMethod::Automatic)
+    // Save data may be encoded on a worker thread, so typed object arguments are turned into paths now.
+    for (FActorIOMessage& Message : OutSaveData.PendingMessages)
     {
-        ActivateLevel(InLevel);
+        Message.ResolveObjectArguments();
     }
 }
 
-void UActorIOSubsystemBase::OnLevelRemovedFromWorld(ULevel* InLevel, UWorld* InWorld)
+void UActorIOSubsystemBase::ApplySaveData(const FActorIOWorldSaveData& InSaveData)
 {
-    if (InWorld != GetWorld())
+    check(IsInGameThread());
+
+    UWorld* MyWorld = GetWorld();
+    if (!MyWorld)
     {
-        // Do nothing if the level was not removed from our world (e.g. other PIE sessions).
         return;
     }
 
-    const UActorIOSettings* IOSettings = UActorIOSettings::Get();
-    if (IOSettings->LevelActivationMethod == ELevelActivationMethod::Automatic)
+    // Match saved levels with the levels of the world once, instead of once per actor.
+    TMap<FString, ULevel*> WorldLevels;
+    for (ULevel* Level : MyWorld->GetLevels())
     {
-        DeactivateLevel(InLevel);
+        if (Level)
+        {
+            WorldLevels.Add(UWorld::RemovePIEPrefix(Level->GetPathName()), Level);
+        }
     }
-}
-
-void UActorIOSubsystemBase::RegisterNativeEventsForObject(AActor* InObject, FActorIOEventList& EventRegistry)
-{
-    //==================================
-    // Trigger Actors
-    //==================================
 
-    if (InObject->IsA<ATriggerBase>())
+    for (const FActorIOLevelSaveData& LevelData : InSaveData.Levels)
     {
-        EventRegistry.RegisterEvent(FActorIOEvent()
-            .SetId(TEXT("ATriggerBase::OnTriggerEnter"))
-            .SetDisplayName(LOCTEXT("TriggerBase.OnTriggerEnter", "OnTriggerEnter"))
-            .SetTooltipText(LOCTEXT("TriggerBase.OnTriggerEnterTooltip", "Event when an actor enters the trigger area."))
-            .SetSparseDelegate(InObject, TEXT("OnActorBeginOverlap"))
-            .SetEventProcessor(this, TEXT("ProcessEvent_OnActorOverlap")));
+        ULevel* const* LevelPtr = WorldLevels.Find(LevelData.LevelPath);
+        if (!LevelPtr)
+        {
+            UE_CLOG(DebugIOActions, LogActorIO, Log, TEXT("Skipped restoring I/O state of level '%s'. Level is not in the world."), *LevelData.LevelPath);
+            continue;
+        }
 
-        EventRegistry.RegisterEvent(FActorIOEvent()
-            .SetId(TEXT("ATriggerBase::OnTriggerExit"))
-            .SetDisplayName(LOCTEXT("TriggerBase.OnTriggerExit", "OnTriggerExit"))
-            .SetTooltipText(LOCTEXT("TriggerBase.OnTriggerExitTooltip", "Event when an actor leaves the trigger area."))
-            .SetSparseDelegate(InObject, TEXT("OnActorEndOverlap"))
-            .SetEventProcessor(this, TEXT("ProcessEvent_OnActorOverlap")));
-    }
+        ULevel* Level = *LevelPtr;
 
-    //==================================
-    // Sequence Actors
-    //==================================
+        // The saved messages of the level replace its current messages.
+        // Otherwise applying the same save data twice would deliver every message twice.
+        RemovePendingMessages(Level);
 
-    // In the case of ALevelSequenceActor, we are comparing the class name directly to avoid dependency to LevelSequence module.
-    // Note that this does not support class inheritance, so it only works for exact classes.
-    // Since LevelSequenceActor is just a component wrapper, I do not think anyone will ever subclass it anyways.
-    if (InObject->GetClass()->GetFName() == TEXT("LevelSequenceActor") || InObject->GetClass()->GetFName() == TEXT("ReplicatedLevelSequenceActor"))
-    {
-        // The callback events are in the ULevelSequencePlayer subobject of the ALevelSequenceActor.
-        // We can simply get it as a UObject and use reflection data to bind to it (via SetBlueprintDelegate).
-        UObject* LevelSequencePlayer = InObject->GetDefaultSubobjectByName(TEXT("AnimationPlayer"));
+        FMemoryReader PropertyReader = FMemoryReader(LevelData.PropertyData);
+        FObjectAndNameAsStringProxyArchive PropertyArchive = FObjectAndNameAsStringProxyArchive(PropertyReader, false);
+        PropertyArchive.ArIsSaveGame = true;
 
-        EventRegistry.RegisterEvent(FActorIOEvent()
-            .SetId(TEXT("ALevelSequenceActor::OnPlay"))
-            .SetDisplayName(LOCTEXT("LevelSequenceActor.OnPlay", "OnPlay"))
-            .SetTooltipText(LOCTEXT("LevelSequenceActor.OnPlayTooltip", "Event when the level sequence is started."))
-            .SetBlueprintDelegate(LevelSequencePlayer, TEXT("OnPlay")));
+        for (const FActorIOActorSaveData& ActorData : LevelData.Actors)
+        {
+            AActor* Actor = FindObjectFast<AActor>(Level, ActorData.ActorName);
+            if (!IsValid(Actor))
+            {
+                UE_LOG(LogActorIO, Warning, TEXT("%s - No actor found with name '%s'."), *LevelData.LevelPath, *ActorData.ActorName.ToString());
+                continue;
+            }
 
-        EventRegistry.RegisterEvent(FActorIOEvent()
-            .SetId(TEXT("ALevelSequenceActor::OnStop"))
-            .SetDisplayName(LOCTEXT("LevelSequenceActor.OnStop", "OnStop"))
-            .SetTooltipText(LOCTEXT("LevelSequenceActor.OnStopTooltip", "Event when the level sequence is stopped."))
-            .SetBlueprintDelegate(LevelSequencePlayer, TEXT("OnStop")));
+            // Restore save properties first, so that logic actors are in their saved state by the time actions recall their messages.
+            ALogicActorBase* LogicActor = Cast<ALogicActorBase>(Actor);
+            if (LogicActor && ActorData.PropertySize > 0)
+            {
+                PropertyArchive.Seek(ActorData.PropertyOffset);
 
-        EventRegistry.RegisterEvent(FActorIOEvent()
-            .SetId(TEXT("ALevelSequenceActor::OnFinished"))
-            .SetDisplayName(LOCTEXT("LevelSequenceActor.OnFinished", "OnFinished"))
-            .SetTooltipText(LOCTEXT("LevelSequenceActor.OnFinishedTooltip", "Event when the level sequence finishes naturally (without explicitly calling stop)."))
-            .SetBlueprintDelegate(LevelSequencePlayer, TEXT("OnFinished")));
-    }
+                LogicActor->PreSerializeLogicActor(PropertyArchive);
+                LogicActor->SerializeScriptProperties(PropertyArchive);
+                LogicActor->PostSerializeLogicActor(PropertyArchive);
 
-    //==================================
-    // Non Logic Actors
-    //==================================
+                if (!ensureMsgf(PropertyArchive.Tell() <= ActorData.PropertyOffset + ActorData.PropertySize, TEXT("%s - Serialized more data then expected when loading save properties!"), *Actor->GetPathName()))
+                {
+                    continue;
+                }
+            }
 
-    if (!InObject->IsA<ALogicActorBase>())
-    {
-        EventRegistry.RegisterEvent(FActorIOEvent()
-            .SetId(TEXT("AActor::OnDestroyed"))
-            .SetDisplayName(LOCTEXT("Actor.OnDestroyed", "OnDestroyed"))
-            .SetTooltipText(LOCTEXT("Actor.OnDestroyedTooltip", "Event when the actor is getting destroyed."))
-            .SetSparseDelegate(InObject, TEXT("OnEndPlay"))
-            .SetEventProcessor(this, TEXT("ProcessEvent_OnActorDestroyed")));
+            UActorIOComponent* IOComponent = Actor->FindComponentByClass<UActorIOComponent>();
+            if (IOComponent && ActorData.ExecutedStates.Num() > 0)
+            {
+                // Bits can't be matched with actions if the layout is different, e.g. the level was modified after the save was made.
+                // In that case the actions are matched by their stable ids instead.
+                if (ActorData.ExecutedStates.Num() != IOComponent->GetNumActions() || ActorData.LayoutHash != IOComponent->GetActionLayoutHash())
+                {
+                    // Save data from before ids were saved has no ids, even if some actions were executed.
+                    const bool bHasExecutedActionIds = ActorData.ExecutedActionIds.Num() > 0 || !ActorData.ExecutedStates.Contains(true);
+                    if (!bHasExecutedActionIds)
+                    {
+                        UE_LOG(LogActorIO, Warning, TEXT("%s - Action layout has changed since the game was saved. Executed states were not restored."), *IOComponent->GetPathName());
+                        continue;
+                    }
+
+                    UE_CLOG(DebugIOActions, LogActorIO, Log, TEXT("%s - Action layout has changed since the game was saved. Restoring executed states by action id."), *IOComponent->GetPathName());
+                    IOComponent->RestoreExecutedStatesById(ActorData.ExecutedActionIds);
+                    continue;
+                }
+
+                IOComponent->RestoreExecutedStates(ActorData.ExecutedStates);
+            }
+        }
     }
+
+    // Not using QueueMessage, since messages without delay would be processed right away, while the state of other levels may still be restoring.
+    // Instead all restored messages are delivered in their saved order on the next tick at the earliest.
+    PendingMessages.Append(InSaveData.PendingMessages);
 }
 
-void UActorIOSubsystemBase::RegisterNativeFunctionsForObject(AActor* InObject, FActorIOFunctionList& FunctionRegistry)
+void UActorIOSubsystemBase::SerializeWorldToRawData(TArray<uint8>& RawData, ULevel* InLevel)
 {
-    //==================================
-    // Trigger Actors
-    //==================================
+    FActorIOWorldSaveData SaveData;
+    CaptureSaveData(SaveData, InLevel);
+    SaveData.Encode(RawData);
+}
+
+void UActorIOSubsystemBase::SerializeWorldToRawDataAsync(FOnActorIOWorldSerialized OnComplete, ULevel* InLevel, bool bCompress)
+{
+    // Capturing is cheap compared to encoding. It only copies the executed states and the pending messages,
+    // and serializes the save properties of logic actors, which can only be done on the game thread.
+    FActorIOWorldSaveData SaveData;
+    CaptureSaveData(SaveData, InLevel);
 
-    if (InObject->IsA<ATriggerBase>())
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [SaveData = MoveTemp(SaveData), OnComplete = MoveTemp(OnComplete), bCompress]() mutable
     {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ATriggerBase::SetEnabled"))
-            .SetDisplayName(LOCTEXT("TriggerBase.SetEnabled", "SetEnabled"))
-            .SetTooltipText(LOCTEXT("TriggerBase.SetEnabledTooltip", "Change whether collision is enabled for the trigger."))
-            .SetFunction(TEXT("SetActorEnableCollision")));
-    }
+        TArray<uint8> RawData;
+        SaveData.Encode(RawData, bCompress);
 
-    //==================================
-    // Light Actors
-    //==================================
+        AsyncTask(ENamedThreads::GameThread, [RawData = MoveTemp(RawData), OnComplete = MoveTemp(OnComplete)]() mutable
+        {
+            OnComplete.ExecuteIfBound(RawData);
+        });
+    });
+}
+
+void UActorIOSubsystemBase::K2_SerializeWorldToRawDataAsync(FOnActorIOWorldSerializedDynamic OnComplete, ULevel* InLevel, bool bCompress)
+{
+    SerializeWorldToRawDataAsync(FOnActorIOWorldSerialized::CreateLambda([OnComplete](TArray<uint8>& RawData)
+    {
+        OnComplete.ExecuteIfBound(RawData);
+    }), InLevel, bCompress);
+}
 
-    if (InObject->IsA<ALight>())
-    {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ALight::SetLightIntensity"))
-            .SetDisplayName(LOCTEXT("Light.SetLightIntensity", "SetLightIntensity"))
-            .SetTooltipText(LOCTEXT("Light.SetLightIntensityTooltip", "Set intensity of the light."))
-            .SetFunction(TEXT("SetIntensity"))
-            .SetSubobject(TEXT("LightComponent0")));
-
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ALight::SetLightColor"))
-            .SetDisplayName(LOCTEXT("Light.SetLightColor", "SetLightColor"))
-            .SetTooltipText(LOCTEXT("Light.SetLightColorTooltip", "Set color of the light."))
-            .SetFunction(TEXT("SetLightColor"))
-            .SetSubobject(TEXT("LightComponent0")));
-
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ALight::SetVisibility"))
-            .SetDisplayName(LOCTEXT("Light.SetVisibility", "SetVisibility"))
-            .SetTooltipText(LOCTEXT("Light.SetVisibilityTooltip", "Set visibility of the light. Use this to turn light on/off."))
-            .SetFunction(TEXT("SetVisibility"))
-            .SetSubobject(TEXT("LightComponent0")));
-
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ALight::SetCastShadows"))
-            .SetDisplayName(FText::FromString(TEXT("SetCastShadows")))
-            .SetTooltipText(FText::FromString(TEXT("Set light shadow casting on/off.")))
-            .SetFunction(TEXT("SetCastShadows"))
-            .SetSubobject(TEXT("LightComponent0")));
+bool UActorIOSubsystemBase::RestoreWorldFromRawData(const TArray<uint8>& RawData)
+{
+    FActorIOWorldSaveData SaveData;
+    if (!SaveData.Decode(RawData))
+    {
+        UE_LOG(LogActorIO, Error, TEXT("Failed to restore I/O state of the world! Data was malformed."));
+        return false;
     }
 
-    //==================================
-    // Effect Actors
-    //==================================
+    ApplySaveData(SaveData);
+    return true;
+}
+
+bool FActorIOWorldSaveData::Serialize(FArchive& Ar)
+{
+    // Layout:
+    //   [uint32] Magic, [int32] Version
+    //   [int32] NumLevels, followed by the levels
+    //   Level: [string] LevelPath, [int32] NumActors, followed by the actors, [bytes] PropertyData
+    //   Actor: [string] ActorName, [uint32] LayoutHash, [bits] ExecutedStates, [int32] NumExecutedActionIds, [guids] ExecutedActionIds, [packed] PropertyOffset, PropertySize
+    //   Pending messages in compact format.
+    // Names are saved as strings, since name indices are not stable between sessions.
+
+    static constexpr uint32 SaveDataMagic = 0x57494F41; // 'AIOW'
+
+    uint32 Magic = SaveDataMagic;
+    int32 Version = FActorIOSubsystemVersion::LatestVersion;
+    Ar << Magic;
+    Ar << Version;
+
+    if (Ar.IsLoading() && (Magic != SaveDataMagic || Version > FActorIOSubsystemVersion::LatestVersion))
+    {
+        return false;
+    }
 
-    if (InObject->IsA<AEmitter>())
+    int32 NumLevels = Levels.Num();
+    Ar << NumLevels;
+
+    if (Ar.IsLoading())
     {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AEmitter::Activate"))
-            .SetDisplayName(LOCTEXT("Emitter.Activate", "Activate"))
-            .SetTooltipText(LOCTEXT("Emitter.ActivateTooltip", "Activate the particle system."))
-            .SetFunction(TEXT("Activate"))
-            .SetSubobject(TEXT("ParticleSystemComponent0")));
+        if (Ar.IsError() || NumLevels < 0 || NumLevels > Ar.TotalSize())
+        {
+            return false;
+        }
 
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AEmitter::Deactivate"))
-            .SetDisplayName(LOCTEXT("Emitter.Deactivate", "Deactivate"))
-            .SetTooltipText(LOCTEXT("Emitter.DeactivateTooltip", "Deactivate the particle system."))
-            .SetFunction(TEXT("Deactivate"))
-            .SetSubobject(TEXT("ParticleSystemComponent0")));
+        Levels.SetNum(NumLevels);
     }
 
-    // In the case of ANiagaraActor, we are comparing the class name directly to avoid dependency to Niagara module.
-    // Note that this does not support class inheritance, so it only works for exact classes.
-    // Since NiagaraActor is just a component wrapper, I do not think anyone will ever subclass it anyways.
-    if (InObject->GetClass()->GetFName() == TEXT("NiagaraActor"))
+    for (FActorIOLevelSaveData& LevelData : Levels)
     {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ANiagaraActor::Activate"))
-            .SetDisplayName(LOCTEXT("NiagaraActor.Activate", "Activate"))
-            .SetTooltipText(LOCTEXT("NiagaraActor.ActivateTooltip", "Activate the particle system."))
-            .SetFunction(TEXT("Activate"))
-            .SetSubobject(TEXT("NiagaraComponent0")));
+        Ar << LevelData.LevelPath;
+
+        int32 NumActors = LevelData.Actors.Num();
+        Ar << NumActors;
+
+        if (Ar.IsLoading())
+        {
+            if (Ar.IsError() || NumActors < 0 || NumActors > Ar.TotalSize())
+            {
+                return false;
+            }
+
+            LevelData.Actors.SetNum(NumActors);
+        }
+
+        for (FActorIOActorSaveData& ActorData : LevelData.Actors)
+        {
+            FString ActorName;
+            if (Ar.IsSaving())
+            {
+                ActorName = ActorData.ActorName.ToString();
+            }
+
+            Ar << ActorName;
+            Ar << ActorData.LayoutHash;
+            Ar << ActorData.ExecutedStates;
+
+            if (Version >= FActorIOSubsystemVersion::ExecutedActionIds)
+            {
+                int32 NumExecutedActionIds = ActorData.ExecutedActionIds.Num();
+                Ar << NumExecutedActionIds;
+
+                if (Ar.IsLoading())
+                {
+                    if (Ar.IsError() || NumExecutedActionIds < 0 || NumExecutedActionIds > Ar.TotalSize())
+                    {
+                        return false;
+                    }
+
+                    ActorData.ExecutedActionIds.SetNum(NumExecutedActionIds);
+                }
+
+                for (FGuid& ActionId : ActorData.ExecutedActionIds)
+                {
+                    Ar << ActionId;
+                }
+            }
+
+            uint32 PropertyOffset = static_cast<uint32>(ActorData.PropertyOffset);
+            uint32 PropertySize = static_cast<uint32>(ActorData.PropertySize);
+            Ar.SerializeIntPacked(PropertyOffset);
+            Ar.SerializeIntPacked(PropertySize);
+
+            if (Ar.IsLoading())
+            {
+                ActorData.ActorName = FName(*ActorName);
+                ActorData.PropertyOffset = static_cast<int32>(PropertyOffset);
+                ActorData.PropertySize = static_cast<int32>(PropertySize);
+            }
+        }
 
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ANiagaraActor::Deactivate"))
-            .SetDisplayName(LOCTEXT("NiagaraActor.Deactivate", "Deactivate"))
-            .SetTooltipText(LOCTEXT("NiagaraActor.DeactivateTooltip", "Deactivate the particle system."))
-            .SetFunction(TEXT("Deactivate"))
-            .SetSubobject(TEXT("NiagaraComponent0")));
+        Ar << LevelData.PropertyData;
+
+        if (Ar.IsLoading())
+        {
+            for (const FActorIOActorSaveData& ActorData : LevelData.Actors)
+            {
+                if (ActorData.PropertyOffset < 0 || ActorData.PropertySize < 0 || ActorData.PropertyOffset + ActorData.PropertySize > LevelData.PropertyData.Num())
+                {
+                    return false;
+                }
+            }
+        }
     }
 
-    //==================================
-    // Sound Actors
-    //==================================
+    if (!FActorIOMessage::SerializeCompactMessages(Ar, PendingMessages, Version))
+    {
+        return false;
+    }
+
+    return !Ar.IsError();
+}
 
-    if (InObject->IsA<AAmbientSound>())
-    {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AAmbientSound::FadeIn"))
-            .SetDisplayName(LOCTEXT("AmbientSound.FadeIn", "FadeIn"))
-            .SetTooltipText(LOCTEXT("AmbientSound.FadeInTooltip", "Smoothly start playing the sound with a fade."))
-            .SetFunction(TEXT("FadeIn"))
-            .SetSubobject(TEXT("AudioComponent0")));
-
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AAmbientSound::FadeOut"))
-            .SetDisplayName(LOCTEXT("AmbientSound.FadeOut", "FadeOut"))
-            .SetTooltipText(LOCTEXT("AmbientSound.FadeOutTooltip", "Smoothly stop playing the sound with a fade."))
-            .SetFunction(TEXT("FadeOut"))
-            .SetSubobject(TEXT("AudioComponent0")));
-
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AAmbientSound::AdjustVolume"))
-            .SetDisplayName(LOCTEXT("AmbientSound.AdjustVolume", "AdjustVolume"))
-            .SetTooltipText(LOCTEXT("AmbientSound.AdjustVolumeTooltip", "Smoothly adjust the volume of the sound with a fade."))
-            .SetFunction(TEXT("AdjustVolume"))
-            .SetSubobject(TEXT("AudioComponent0")));
-
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AAmbientSound::Play"))
-            .SetDisplayName(LOCTEXT("AmbientSound.Play", "Play"))
-            .SetTooltipText(LOCTEXT("AmbientSound.PlayTooltip", "Start playing the sound. Start time can be given."))
-            .SetFunction(TEXT("Play"))
-            .SetSubobject(TEXT("AudioComponent0")));
-
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AAmbientSound::Stop"))
-            .SetDisplayName(LOCTEXT("AmbientSound.Stop", "Stop"))
-            .SetTooltipText(LOCTEXT("AmbientSound.StopTooltip", "Stop playing the sound."))
-            .SetFunction(TEXT("Stop"))
-            .SetSubobject(TEXT("AudioComponent0")));
+/** Header of compressed world save data. */
+static constexpr uint32 CompressedSaveDataMagic = 0x5A4F4941; // 'AIOZ'
+
+void FActorIOWorldSaveData::Encode(TArray<uint8>& OutRawData, bool bCompress)
+{
+    OutRawData.Reset();
+
+    if (!bCompress)
+    {
+        FMemoryWriter Archive = FMemoryWriter(OutRawData);
+        Serialize(Archive);
+        return;
     }
 
-    //==================================
-    // Volume Actors
-    //==================================
+    TArray<uint8> UncompressedData;
+    FMemoryWriter Archive = FMemoryWriter(UncompressedData);
+    Serialize(Archive);
+
+    // Layout: [uint32] Magic, [int32] UncompressedSize, followed by the compressed data.
+    const int32 HeaderSize = sizeof(uint32) + sizeof(int32);
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, UncompressedData.Num());
+    OutRawData.SetNumUninitialized(HeaderSize + CompressedSize);
 
-    if (InObject->IsA<ABlockingVolume>() || InObject->IsA<ACameraBlockingVolume>())
+    if (!FCompression::CompressMemory(NAME_Zlib, OutRawData.GetData() + HeaderSize, CompressedSize, UncompressedData.GetData(), UncompressedData.Num()))
     {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ABlockingVolume::SetEnabled"))
-            .SetDisplayName(LOCTEXT("BlockingVolume.SetEnabled", "SetEnabled"))
-            .SetTooltipText(LOCTEXT("BlockingVolume.SetEnabledTooltip", "Change whether collision is enabled for the volume actor."))
-            .SetFunction(TEXT("SetActorEnableCollision")));
+        // Fall back to uncompressed data. Decode handles both.
+        OutRawData = MoveTemp(UncompressedData);
+        return;
     }
 
-    if (InObject->IsA<AAudioVolume>())
+    OutRawData.SetNum(HeaderSize + CompressedSize);
+
+    FMemoryWriter HeaderWriter = FMemoryWriter(OutRawData);
+    uint32 Magic = CompressedSaveDataMagic;
+    int32 UncompressedSize = UncompressedData.Num();
+    HeaderWriter << Magic;
+    HeaderWriter << UncompressedSize;
+}
+
+bool FActorIOWorldSaveData::Decode(const TArray<uint8>& InRawData)
+{
+    const int32 HeaderSize = sizeof(uint32) + sizeof(int32);
+    if (InRawData.Num() >= HeaderSize)
     {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AAudioVolume::SetEnabled"))
-            .SetDisplayName(LOCTEXT("AudioVolume.SetEnabled", "SetEnabled"))
-            .SetTooltipText(LOCTEXT("AudioVolume.SetEnabledTooltip", "Set whether the audio volume is enabled or not."))
-            .SetFunction(TEXT("SetEnabled")));
+        FMemoryReader HeaderReader = FMemoryReader(InRawData);
+        uint32 Magic = 0;
+        int32 UncompressedSize = 0;
+        HeaderReader << Magic;
+        HeaderReader << UncompressedSize;
+
+        if (Magic == CompressedSaveDataMagic)
+        {
+            if (UncompressedSize < 0)
+            {
+                return false;
+            }
+
+            TArray<uint8> UncompressedData;
+            UncompressedData.SetNumUninitialized(UncompressedSize);
+
+            if (!FCompression::UncompressMemory(NAME_Zlib, UncompressedData.GetData(), UncompressedSize, InRawData.GetData() + HeaderSize, InRawData.Num() - HeaderSize))
+            {
+                return false;
+            }
+
+            FMemoryReader Archive = FMemoryReader(UncompressedData);
+            return Serialize(Archive);
+        }
     }
 
-    //==================================
-    // Mesh Actors
-    //==================================
+    FMemoryReader Archive = FMemoryReader(InRawData);
+    return Serialize(Archive);
+}
+
+void UActorIOSubsystemBase::Serialize(FStructuredArchive::FRecord Record)
+{
+    Super::Serialize(Record);
+
+    FArchive& UnderlyingArchive = Record.GetUnderlyingArchive();
+    if (UnderlyingArchive.IsSaveGame())
+    {
+        UnderlyingArchive.UsingCustomVersion(FActorIOSubsystemVersion::GUID);
+
+        int32 Version = UnderlyingArchive.CustomVer(FActorIOSubsystemVersion::GUID);
+        Record << SA_VALUE(TEXT("Version"), Version);
+
+        if (UnderlyingArchive.IsLoading())
+        {
+            UnderlyingArchive.SetCustomVersion(FActorIOSubsystemVersion::GUID, Version, TEXT("ActorIOSubsystemVer"));
+        }
+
+        TArray<FActorIOMessage> Messages;
+
+        if (Version >= FActorIOSubsystemVersion::CompactMessageFormat)
+        {
+            // Pending messages are written into a single compact blob.
+            // Paths, function ids and arguments are deduplicated, so saves with lots of delayed messages stay small.
+            TArray<uint8> MessageData;
+            if (UnderlyingArchive.IsSaving())
+            {
+                FMemoryWriter MessageWriter = FMemoryWriter(MessageData);
+                FActorIOMessage::SerializeCompactMessages(MessageWriter, PendingMessages, Version);
+            }
+
+            Record << SA_VALUE(TEXT("PendingMessagesData"), MessageData);
+
+            if (UnderlyingArchive.IsLoading())
+            {
+                FMemoryReader MessageReader = FMemoryReader(MessageData);
+                if (!ensureMsgf(FActorIOMessage::SerializeCompactMessages(MessageReader, Messages, Version), TEXT("Failed to load PendingMessages of I/O subsystem! Data was malformed.")))
+                {
+                    UnderlyingArchive.SetError();
+                    return;
+                }
+            }
+        }
+        else
+        {
+            // Legacy format with a full record for every message.
+            int32 NumMessages = 0;
+
+            if (UnderlyingArchive.IsSaving())
+            {
+                Messages = PendingMessages;
+                NumMessages = PendingMessages.Num();
+            }
+
+            FStructuredArchive::FArray MessageArray = Record.EnterArray(TEXT("PendingMessages"), NumMessages);
+
+            for (int32 MessageIdx = 0; MessageIdx != NumMessages; ++MessageIdx)
+            {
+                FStructuredArchive::FSlot MessageSlot = MessageArray.EnterElement();
+                FStructuredArchive::FRecord MessageRecord = MessageSlot.EnterRecord();
+
+                const int64 DataSizePosition = UnderlyingArchive.Tell();
+                int64 DataSize = 0;
+
+                // Pre-serialize the data size. We'll rewrite this after serializing the action.
+                if (!UnderlyingArchive.IsTextFormat())
+                {
+                    MessageRecord << SA_VALUE(TEXT("DataSize"), DataSize);
+                }
+
+                const int64 BeginDataPosition = UnderlyingArchive.Tell();
+
+                if (UnderlyingArchive.IsLoading())
+                {
+                    FActorIOMessage& Message = Messages.AddDefaulted_GetRef();
+                    Message.SerializeMessage(MessageRecord);
+
+                    if (!UnderlyingArchive.IsTextFormat())
+                    {
+                        if (!ensureMsgf(UnderlyingArchive.Tell() <= BeginDataPosition + DataSize, TEXT("Serialized more data then expected when loading PendingMessages of I/O subsystem!")))
+                        {
+                            UnderlyingArchive.SetError();
+                            return;
+                        }
+
+                        UnderlyingArchive.Seek(BeginDataPosition + DataSize);
+                    }
+                }
+                else
+                {
+                    FActorIOMessage& Message = Messages[MessageIdx];
+                    Message.SerializeMessage(MessageRecord);
+
+                    // Seek back and re-write the data size with the actual size.
+                    if (!UnderlyingArchive.IsTextFormat())
+                    {
+                        const int64 EndDataPosition = UnderlyingArchive.Tell();
+                        DataSize = EndDataPosition - BeginDataPosition;
+
+                        UnderlyingArchive.Seek(DataSizePosition);
+                        UnderlyingArchive << DataSize;
+                        UnderlyingArchive.Seek(EndDataPosition);
+                    }
+                }
+            }
+        }
 
-    if (InObject->IsA<AStaticMeshActor>())
+        // Now queue all loaded messages.
+        // The loaded list replaces the current one, otherwise messages that were already pending would be duplicated.
+        if (UnderlyingArchive.IsLoading())
+        {
+            PendingMessages.Reset(Messages.Num());
+            for (FActorIOMessage& LoadedMessage : Messages)
+            {
+                QueueMessage(LoadedMessage);
+            }
+        }
+    }
+}
+
+void UActorIOSubsystemBase::OnLevelAddedToWorld(ULevel* InLevel, UWorld* InWorld)
+{
+    if (InWorld != GetWorld())
     {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AStaticMeshActor::SetEnableCollision"))
-            .SetDisplayName(LOCTEXT("StaticMeshActor.SetEnableCollision", "SetEnableCollision"))
-            .SetTooltipText(LOCTEXT("StaticMeshActor.SetEnableCollisionTooltip", "Set whether collision is enabled for the actor."))
-            .SetFunction(TEXT("SetActorEnableCollision")));
+        // Do nothing if the level was not added to our world (e.g. other PIE sessions).
+        return;
+    }
 
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AStaticMeshActor::SetSimulatePhysics"))
-            .SetDisplayName(LOCTEXT("StaticMeshActor.SetSimulatePhysics", "SetSimulatePhysics"))
-            .SetTooltipText(LOCTEXT("StaticMeshActor.SetSimulatePhysicsTooltip", "Set physics simulation on/off."))
-            .SetFunction(TEXT("SetSimulatePhysics"))
-            .SetSubobject(TEXT("StaticMeshComponent0")));
+    const UActorIOSettings* IOSettings = UActorIOSettings::Get();
+    if (IOSettings->LevelActivationMethod == ELevelActivationMethod::Automatic)
+    {
+        // If the actions of the level are still being bound, activate the level once binding is finished.
+        FPendingLevelBinding* LevelBinding = PendingLevelBindings.FindByPredicate([InLevel](const FPendingLevelBinding& Element)
+        {
+            return Element.Level.Get() == InLevel;
+        });
 
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AStaticMeshActor::SetHiddenInGame"))
-            .SetDisplayName(LOCTEXT("StaticMeshActor.SetHiddenInGame", "SetHiddenInGame"))
-            .SetTooltipText(LOCTEXT("StaticMeshActor.SetHiddenInGameTooltip", "Set whether the actor is hidden or not."))
-            .SetFunction(TEXT("SetActorHiddenInGame")));
+        if (LevelBinding)
+        {
+            LevelBinding->bActivateWhenDone = true;
+        }
+        else
+        {
+            ActivateLevel(InLevel);
+        }
+    }
+}
+
+void UActorIOSubsystemBase::OnLevelRemovedFromWorld(ULevel* InLevel, UWorld* InWorld)
+{
+    if (InWorld != GetWorld())
+    {
+        // Do nothing if the level was not removed from our world (e.g. other PIE sessions).
+        return;
     }
 
+    // Components of the level are going away, so there is nothing left to bind.
+    PendingLevelBindings.RemoveAll([InLevel](const FPendingLevelBinding& Element)
+    {
+        return Element.Level.Get() == InLevel;
+    });
+
+    // Actors of the level are going away, so drop cached subobjects that are no longer valid.
+    for (auto It = SubobjectCache.CreateIterator(); It; ++It)
+    {
+        if (!It->Key.Key.ResolveObjectPtr() || !It->Value.IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    const UActorIOSettings* IOSettings = UActorIOSettings::Get();
+    if (IOSettings->LevelActivationMethod == ELevelActivationMethod::Automatic)
+    {
+        DeactivateLevel(InLevel);
+    }
+}
+
+void UActorIOSubsystemBase::BuildRegistrationTable(TArray<FActorIORegisteredEvent>& EventTable, TArray<FActorIORegisteredFunction>& FunctionTable)
+{
+    // In the case of ALevelSequenceActor and ANiagaraActor, we are referencing the classes by path to avoid dependency to their modules.
+    // These are registered for the exact classes only, so they won't apply to any subclasses.
+    // Since these actors are just component wrappers, I do not think anyone will ever subclass them anyways.
+    const TSoftClassPtr<AActor> LevelSequenceActorClass = TSoftClassPtr<AActor>(FSoftObjectPath(TEXT("/Script/LevelSequence.LevelSequenceActor")));
+    const TSoftClassPtr<AActor> ReplicatedLevelSequenceActorClass = TSoftClassPtr<AActor>(FSoftObjectPath(TEXT("/Script/LevelSequence.ReplicatedLevelSequenceActor")));
+    const TSoftClassPtr<AActor> NiagaraActorClass = TSoftClassPtr<AActor>(FSoftObjectPath(TEXT("/Script/Niagara.NiagaraActor")));
+
+    //==================================
+    // Trigger Actors
+    //==================================
+
+    EventTable.Add(FActorIORegisteredEvent(ATriggerBase::StaticClass())
+        .SetId(TEXT("ATriggerBase::OnTriggerEnter"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("TriggerBase.OnTriggerEnter", "OnTriggerEnter")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("TriggerBase.OnTriggerEnterTooltip", "Event when an actor enters the trigger area.")))
+        .SetSparseDelegate(TEXT("OnActorBeginOverlap"))
+        .SetEventProcessor(TEXT("ProcessEvent_OnActorOverlap")));
+
+    EventTable.Add(FActorIORegisteredEvent(ATriggerBase::StaticClass())
+        .SetId(TEXT("ATriggerBase::OnTriggerExit"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("TriggerBase.OnTriggerExit", "OnTriggerExit")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("TriggerBase.OnTriggerExitTooltip", "Event when an actor leaves the trigger area.")))
+        .SetSparseDelegate(TEXT("OnActorEndOverlap"))
+        .SetEventProcessor(TEXT("ProcessEvent_OnActorOverlap")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(ATriggerBase::StaticClass())
+        .SetId(TEXT("ATriggerBase::SetEnabled"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("TriggerBase.SetEnabled", "SetEnabled")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("TriggerBase.SetEnabledTooltip", "Change whether collision is enabled for the trigger.")))
+        .SetFunction(TEXT("SetActorEnableCollision")));
+
+    //==================================
+    // Light Actors
+    //==================================
+
+    FunctionTable.Add(FActorIORegisteredFunction(ALight::StaticClass())
+        .SetId(TEXT("ALight::SetLightIntensity"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("Light.SetLightIntensity", "SetLightIntensity")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("Light.SetLightIntensityTooltip", "Set intensity of the light.")))
+        .SetFunction(TEXT("SetIntensity"))
+        .SetSubobject(TEXT("LightComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(ALight::StaticClass())
+        .SetId(TEXT("ALight::SetLightColor"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("Light.SetLightColor", "SetLightColor")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("Light.SetLightColorTooltip", "Set color of the light.")))
+        .SetFunction(TEXT("SetLightColor"))
+        .SetSubobject(TEXT("LightComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(ALight::StaticClass())
+        .SetId(TEXT("ALight::SetVisibility"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("Light.SetVisibility", "SetVisibility")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("Light.SetVisibilityTooltip", "Set visibility of the light. Use this to turn light on/off.")))
+        .SetFunction(TEXT("SetVisibility"))
+        .SetSubobject(TEXT("LightComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(ALight::StaticClass())
+        .SetId(TEXT("ALight::SetCastShadows"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(FText::FromString(TEXT("SetCastShadows"))))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(FText::FromString(TEXT("Set light shadow casting on/off."))))
+        .SetFunction(TEXT("SetCastShadows"))
+        .SetSubobject(TEXT("LightComponent0")));
+
+    //==================================
+    // Effect Actors
+    //==================================
+
+    FunctionTable.Add(FActorIORegisteredFunction(AEmitter::StaticClass())
+        .SetId(TEXT("AEmitter::Activate"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("Emitter.Activate", "Activate")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("Emitter.ActivateTooltip", "Activate the particle system.")))
+        .SetFunction(TEXT("Activate"))
+        .SetSubobject(TEXT("ParticleSystemComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(AEmitter::StaticClass())
+        .SetId(TEXT("AEmitter::Deactivate"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("Emitter.Deactivate", "Deactivate")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("Emitter.DeactivateTooltip", "Deactivate the particle system.")))
+        .SetFunction(TEXT("Deactivate"))
+        .SetSubobject(TEXT("ParticleSystemComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(NiagaraActorClass)
+        .SetExactClass()
+        .SetId(TEXT("ANiagaraActor::Activate"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("NiagaraActor.Activate", "Activate")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("NiagaraActor.ActivateTooltip", "Activate the particle system.")))
+        .SetFunction(TEXT("Activate"))
+        .SetSubobject(TEXT("NiagaraComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(NiagaraActorClass)
+        .SetExactClass()
+        .SetId(TEXT("ANiagaraActor::Deactivate"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("NiagaraActor.Deactivate", "Deactivate")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("NiagaraActor.DeactivateTooltip", "Deactivate the particle system.")))
+        .SetFunction(TEXT("Deactivate"))
+        .SetSubobject(TEXT("NiagaraComponent0")));
+
+    //==================================
+    // Sound Actors
+    //==================================
+
+    FunctionTable.Add(FActorIORegisteredFunction(AAmbientSound::StaticClass())
+        .SetId(TEXT("AAmbientSound::FadeIn"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("AmbientSound.FadeIn", "FadeIn")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("AmbientSound.FadeInTooltip", "Smoothly start playing the sound with a fade.")))
+        .SetFunction(TEXT("FadeIn"))
+        .SetSubobject(TEXT("AudioComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(AAmbientSound::StaticClass())
+        .SetId(TEXT("AAmbientSound::FadeOut"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("AmbientSound.FadeOut", "FadeOut")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("AmbientSound.FadeOutTooltip", "Smoothly stop playing the sound with a fade.")))
+        .SetFunction(TEXT("FadeOut"))
+        .SetSubobject(TEXT("AudioComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(AAmbientSound::StaticClass())
+        .SetId(TEXT("AAmbientSound::AdjustVolume"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("AmbientSound.AdjustVolume", "AdjustVolume")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("AmbientSound.AdjustVolumeTooltip", "Smoothly adjust the volume of the sound with a fade.")))
+        .SetFunction(TEXT("AdjustVolume"))
+        .SetSubobject(TEXT("AudioComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(AAmbientSound::StaticClass())
+        .SetId(TEXT("AAmbientSound::Play"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("AmbientSound.Play", "Play")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("AmbientSound.PlayTooltip", "Start playing the sound. Start time can be given.")))
+        .SetFunction(TEXT("Play"))
+        .SetSubobject(TEXT("AudioComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(AAmbientSound::StaticClass())
+        .SetId(TEXT("AAmbientSound::Stop"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("AmbientSound.Stop", "Stop")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("AmbientSound.StopTooltip", "Stop playing the sound.")))
+        .SetFunction(TEXT("Stop"))
+        .SetSubobject(TEXT("AudioComponent0")));
+
+    //==================================
+    // Volume Actors
+    //==================================
+
+    FunctionTable.Add(FActorIORegisteredFunction(ABlockingVolume::StaticClass())
+        .SetId(TEXT("ABlockingVolume::SetEnabled"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("BlockingVolume.SetEnabled", "SetEnabled")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("BlockingVolume.SetEnabledTooltip", "Change whether collision is enabled for the volume actor.")))
+        .SetFunction(TEXT("SetActorEnableCollision")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(ACameraBlockingVolume::StaticClass())
+        .SetId(TEXT("ABlockingVolume::SetEnabled"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("BlockingVolume.SetEnabled", "SetEnabled")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("BlockingVolume.SetEnabledTooltip", "Change whether collision is enabled for the volume actor.")))
+        .SetFunction(TEXT("SetActorEnableCollision")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(AAudioVolume::StaticClass())
+        .SetId(TEXT("AAudioVolume::SetEnabled"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("AudioVolume.SetEnabled", "SetEnabled")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("AudioVolume.SetEnabledTooltip", "Set whether the audio volume is enabled or not.")))
+        .SetFunction(TEXT("SetEnabled")));
+
+    //==================================
+    // Mesh Actors
+    //==================================
+
+    FunctionTable.Add(FActorIORegisteredFunction(AStaticMeshActor::StaticClass())
+        .SetId(TEXT("AStaticMeshActor::SetEnableCollision"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("StaticMeshActor.SetEnableCollision", "SetEnableCollision")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("StaticMeshActor.SetEnableCollisionTooltip", "Set whether collision is enabled for the actor.")))
+        .SetFunction(TEXT("SetActorEnableCollision")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(AStaticMeshActor::StaticClass())
+        .SetId(TEXT("AStaticMeshActor::SetSimulatePhysics"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("StaticMeshActor.SetSimulatePhysics", "SetSimulatePhysics")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("StaticMeshActor.SetSimulatePhysicsTooltip", "Set physics simulation on/off.")))
+        .SetFunction(TEXT("SetSimulatePhysics"))
+        .SetSubobject(TEXT("StaticMeshComponent0")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(AStaticMeshActor::StaticClass())
+        .SetId(TEXT("AStaticMeshActor::SetHiddenInGame"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("StaticMeshActor.SetHiddenInGame", "SetHiddenInGame")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("StaticMeshActor.SetHiddenInGameTooltip", "Set whether the actor is hidden or not.")))
+        .SetFunction(TEXT("SetActorHiddenInGame")));
+
     //==================================
     // Text Render Actors
     //==================================
 
-    if (InObject->IsA<ATextRenderActor>())
-    {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ATextRenderActor::SetText"))
-            .SetDisplayName(LOCTEXT("TextRenderActor.SetText", "SetText"))
-            .SetTooltipText(LOCTEXT("TextRenderActor.SetTextTooltip", "Change the displayed text."))
-            .SetFunction(TEXT("K2_SetText"))
-            .SetSubobject(TEXT("NewTextRenderComponent")));
+    FunctionTable.Add(FActorIORegisteredFunction(ATextRenderActor::StaticClass())
+        .SetId(TEXT("ATextRenderActor::SetText"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("TextRenderActor.SetText", "SetText")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("TextRenderActor.SetTextTooltip", "Change the displayed text.")))
+        .SetFunction(TEXT("K2_SetText"))
+        .SetSubobject(TEXT("NewTextRenderComponent")));
 
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ATextRenderActor::SetTextRenderColor"))
-            .SetDisplayName(LOCTEXT("TextRenderActor.SetTextRenderColor", "SetTextRenderColor"))
-            .SetTooltipText(LOCTEXT("TextRenderActor.SetTextRenderColorTooltip", "Set color of the text."))
-            .SetFunction(TEXT("SetTextRenderColor"))
-            .SetSubobject(TEXT("NewTextRenderComponent")));
-    }
+    FunctionTable.Add(FActorIORegisteredFunction(ATextRenderActor::StaticClass())
+        .SetId(TEXT("ATextRenderActor::SetTextRenderColor"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("TextRenderActor.SetTextRenderColor", "SetTextRenderColor")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("TextRenderActor.SetTextRenderColorTooltip", "Set color of the text.")))
+        .SetFunction(TEXT("SetTextRenderColor"))
+        .SetSubobject(TEXT("NewTextRenderComponent")));
 
     //==================================
     // Sequence Actors
     //==================================
 
-    // In the case of ALevelSequenceActor, we are comparing the class name directly to avoid dependency to LevelSequence module.
-    // Note that this does not support class inheritance, so it only works for exact classes.
-    // Since LevelSequenceActor is just a component wrapper, I do not think anyone will ever subclass it anyways.
-    if (InObject->GetClass()->GetFName() == TEXT("LevelSequenceActor"))
+    // The callback events are in the ULevelSequencePlayer subobject of the ALevelSequenceActor.
+    // We can simply get it as a UObject and use reflection data to bind to it (via SetBlueprintDelegate).
+    for (const TSoftClassPtr<AActor>& SequenceActorClass : { LevelSequenceActorClass, ReplicatedLevelSequenceActorClass })
     {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ALevelSequenceActor::Play"))
-            .SetDisplayName(LOCTEXT("LevelSequenceActor.Play", "Play"))
-            .SetTooltipText(LOCTEXT("LevelSequenceActor.PlayTooltip", "Start playing the sequence."))
-            .SetFunction(TEXT("Play"))
-            .SetSubobject(TEXT("AnimationPlayer")));
+        EventTable.Add(FActorIORegisteredEvent(SequenceActorClass)
+            .SetExactClass()
+            .SetId(TEXT("ALevelSequenceActor::OnPlay"))
+            .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LevelSequenceActor.OnPlay", "OnPlay")))
+            .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LevelSequenceActor.OnPlayTooltip", "Event when the level sequence is started.")))
+            .SetBlueprintDelegate(TEXT("OnPlay"), TEXT("AnimationPlayer")));
+
+        EventTable.Add(FActorIORegisteredEvent(SequenceActorClass)
+            .SetExactClass()
+            .SetId(TEXT("ALevelSequenceActor::OnStop"))
+            .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LevelSequenceActor.OnStop", "OnStop")))
+            .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LevelSequenceActor.OnStopTooltip", "Event when the level sequence is stopped.")))
+            .SetBlueprintDelegate(TEXT("OnStop"), TEXT("AnimationPlayer")));
 
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("ALevelSequenceActor::Stop"))
-            .SetDisplayName(LOCTEXT("LevelSequenceActor.Stop", "Stop"))
-            .SetTooltipText(LOCTEXT("LevelSequenceActor.StopTooltip", "Go to end of the sequence and stop. Adheres to 'When Finished' section rules."))
-            .SetFunction(TEXT("GoToEndAndStop"))
-            .SetSubobject(TEXT("AnimationPlayer")));
+        EventTable.Add(FActorIORegisteredEvent(SequenceActorClass)
+            .SetExactClass()
+            .SetId(TEXT("ALevelSequenceActor::OnFinished"))
+            .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LevelSequenceActor.OnFinished", "OnFinished")))
+            .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LevelSequenceActor.OnFinishedTooltip", "Event when the level sequence finishes naturally (without explicitly calling stop).")))
+            .SetBlueprintDelegate(TEXT("OnFinished"), TEXT("AnimationPlayer")));
     }
 
+    FunctionTable.Add(FActorIORegisteredFunction(LevelSequenceActorClass)
+        .SetExactClass()
+        .SetId(TEXT("ALevelSequenceActor::Play"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LevelSequenceActor.Play", "Play")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LevelSequenceActor.PlayTooltip", "Start playing the sequence.")))
+        .SetFunction(TEXT("Play"))
+        .SetSubobject(TEXT("AnimationPlayer")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(LevelSequenceActorClass)
+        .SetExactClass()
+        .SetId(TEXT("ALevelSequenceActor::Stop"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LevelSequenceActor.Stop", "Stop")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LevelSequenceActor.StopTooltip", "Go to end of the sequence and stop. Adheres to 'When Finished' section rules.")))
+        .SetFunction(TEXT("GoToEndAndStop"))
+        .SetSubobject(TEXT("AnimationPlayer")));
+
     //==================================
     // Non Logic Actors
     //==================================
 
-    if (!InObject->IsA<ALogicActorBase>())
+    EventTable.Add(FActorIORegisteredEvent(AActor::StaticClass())
+        .AddExcludedClass(ALogicActorBase::StaticClass())
+        .SetId(TEXT("AActor::OnDestroyed"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("Actor.OnDestroyed", "OnDestroyed")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("Actor.OnDestroyedTooltip", "Event when the actor is getting destroyed.")))
+        .SetSparseDelegate(TEXT("OnEndPlay"))
+        .SetEventProcessor(TEXT("ProcessEvent_OnActorDestroyed")));
+
+    FunctionTable.Add(FActorIORegisteredFunction(AActor::StaticClass())
+        .AddExcludedClass(ALogicActorBase::StaticClass())
+        .SetId(TEXT("AActor::Destroy"))
+        .SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("Actor.Destroy", "Destroy")))
+        .SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("Actor.DestroyTooltip", "Destroy the actor.")))
+        .SetFunction(TEXT("K2_DestroyActor")));
+
+    //==================================
+    // Registration Tables
+    //==================================
+
+    const UActorIOSettings* IOSettings = UActorIOSettings::Get();
+    for (const TSoftObjectPtr<UActorIORegistrationTable>& TablePtr : IOSettings->RegistrationTables)
     {
-        FunctionRegistry.RegisterFunction(FActorIOFunction()
-            .SetId(TEXT("AActor::Destroy"))
-            .SetDisplayName(LOCTEXT("Actor.Destroy", "Destroy"))
-            .SetTooltipText(LOCTEXT("Actor.DestroyTooltip", "Destroy the actor."))
-            .SetFunction(TEXT("K2_DestroyActor")));
+        const UActorIORegistrationTable* Table = TablePtr.LoadSynchronous();
+        if (Table)
+        {
+            EventTable.Append(Table->Events);
+            FunctionTable.Append(Table->Functions);
+        }
     }
 }
 
+const UActorIOSubsystemBase::FClassRegistrations& UActorIOSubsystemBase::GetRegistrationsForClass(UClass* InClass)
+{
+    if (const FClassRegistrations* CachedRegistrations = ClassRegistrationCache.Find(InClass))
+    {
+        return *CachedRegistrations;
+    }
+
+    // Walk the class hierarchy once, and match the table entries against it by class path.
+    // Entries are kept in table order, so the order of registered events and functions is the same for every class.
+    TArray<FTopLevelAssetPath, TInlineAllocator<16>> ClassHierarchy;
+    for (const UClass* Class = InClass; Class; Class = Class->GetSuperClass())
+    {
+        ClassHierarchy.Add(Class->GetClassPathName());
+    }
+
+    FClassRegistrations Registrations;
+
+    for (int32 EventIdx = 0; EventIdx != RegisteredEvents.Num(); ++EventIdx)
+    {
+        const FActorIORegisteredEvent& Event = RegisteredEvents[EventIdx];
+        if (IsRegistrationMatchingClass(ClassHierarchy, Event.ActorClass, Event.bExactClass, Event.ExcludedClasses))
+        {
+            Registrations.EventIndices.Add(EventIdx);
+        }
+    }
+
+    for (const FActorIORegisteredFunction& Function : RegisteredFunctions)
+    {
+        if (IsRegistrationMatchingClass(ClassHierarchy, Function.ActorClass, Function.bExactClass, Function.ExcludedClasses))
+        {
+            Registrations.Functions.Add(FActorIOFunction()
+                .SetId(Function.FunctionId)
+                .SetDisplayName(ACTORIO_EDITOR_TEXT(Function.DisplayName))
+                .SetTooltipText(ACTORIO_EDITOR_TEXT(Function.TooltipText))
+                .SetFunction(Function.FunctionToExec)
+                .SetSubobject(Function.TargetSubobject));
+        }
+    }
+
+    // Blueprint registrations are only read from the class registry if the class did not opt into dynamic registration.
+    if (ClassRegistry)
+    {
+        const UActorIOSettings* IOSettings = UActorIOSettings::Get();
+        const bool bIsDynamicClass = IOSettings->DynamicRegistrationClasses.ContainsByPredicate([&ClassHierarchy](const TSoftClassPtr<AActor>& DynamicClass)
+        {
+            return ClassHierarchy.Contains(DynamicClass.ToSoftObjectPath().GetAssetPath());
+        });
+
+        // Stale registrations fall back to calling the blueprint functions. This is only checked once per class, since the result is cached.
+        const FActorIOClassRegistration* StaticRegistration = ClassRegistry->FindRegistration(InClass);
+        if (StaticRegistration && !bIsDynamicClass)
+        {
+            FString StaleReason;
+            if (UActorIOClassRegistry::IsRegistrationValid(InClass, *StaticRegistration, StaleReason))
+            {
+                Registrations.StaticRegistration = *StaticRegistration;
+            }
+            else
+            {
+                UE_LOG(LogActorIO, Warning, TEXT("Captured I/O registrations of class '%s' are out of date: %s The class will use dynamic registration. Recompile the blueprint to fix this."), *InClass->GetName(), *StaleReason);
+            }
+        }
+    }
+
+    return ClassRegistrationCache.Add(InClass, MoveTemp(Registrations));
+}
+
+bool UActorIOSubsystemBase::IsRegistrationMatchingClass(TConstArrayView<FTopLevelAssetPath> ClassHierarchy, const TSoftClassPtr<AActor>& InActorClass, bool bExactClass, const TArray<TSoftClassPtr<AActor>>& InExcludedClasses)
+{
+    const int32 Depth = ClassHierarchy.IndexOfByKey(InActorClass.ToSoftObjectPath().GetAssetPath());
+    if (Depth == INDEX_NONE || (bExactClass && Depth != 0))
+    {
+        return false;
+    }
+
+    for (const TSoftClassPtr<AActor>& ExcludedClass : InExcludedClasses)
+    {
+        if (ClassHierarchy.Contains(ExcludedClass.ToSoftObjectPath().GetAssetPath()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#if WITH_EDITOR
+void UActorIOSubsystemBase::GetRegisteredEventsForClass(UClass* InClass, TArray<FActorIORegisteredEvent>& OutEvents)
+{
+    OutEvents.Reset();
+
+    const UActorIOSettings* IOSettings = UActorIOSettings::Get();
+    UClass* SubsystemClass = IOSettings->ActorIOSubsystemClass.Get();
+    if (!InClass || !SubsystemClass)
+    {
+        return;
+    }
+
+    // The registration table only depends on the subsystem class, so the class default object can build it.
+    TArray<FActorIORegisteredEvent> EventTable;
+    TArray<FActorIORegisteredFunction> FunctionTable;
+    SubsystemClass->GetDefaultObject<UActorIOSubsystemBase>()->BuildRegistrationTable(EventTable, FunctionTable);
+
+    TArray<FTopLevelAssetPath, TInlineAllocator<16>> ClassHierarchy;
+    for (const UClass* Class = InClass; Class; Class = Class->GetSuperClass())
+    {
+        ClassHierarchy.Add(Class->GetClassPathName());
+    }
+
+    for (FActorIORegisteredEvent& Event : EventTable)
+    {
+        if (IsRegistrationMatchingClass(ClassHierarchy, Event.ActorClass, Event.bExactClass, Event.ExcludedClasses))
+        {
+            OutEvents.Add(MoveTemp(Event));
+        }
+    }
+}
+#endif
+
+void UActorIOSubsystemBase::RegisterNativeEventsForObject(AActor* InObject, FActorIOEventList& EventRegistry)
+{
+    const FClassRegistrations& Registrations = GetRegistrationsForClass(InObject->GetClass());
+    for (int32 EventIdx : Registrations.EventIndices)
+    {
+        const FActorIORegisteredEvent& Event = RegisteredEvents[EventIdx];
+
+        // Events are bound to delegates of the actual actor instance, so these can't be memoized.
+        UObject* DelegateOwner = Event.DelegateSubobject.IsNone() ? InObject : FindTargetSubobject(InObject, Event.DelegateSubobject);
+
+        FActorIOEvent NewEvent = FActorIOEvent()
+            .SetId(Event.EventId)
+            .SetDisplayName(ACTORIO_EDITOR_TEXT(Event.DisplayName))
+            .SetTooltipText(ACTORIO_EDITOR_TEXT(Event.TooltipText));
+
+        if (Event.DelegateType == EActorIORegisteredDelegateType::SparseDelegate)
+        {
+            NewEvent.SetSparseDelegate(DelegateOwner, Event.DelegateName);
+        }
+        else
+        {
+            NewEvent.SetBlueprintDelegate(DelegateOwner, Event.DelegateName);
+        }
+
+        if (!Event.EventProcessor.IsNone())
+        {
+            NewEvent.SetEventProcessor(this, Event.EventProcessor);
+        }
+
+        EventRegistry.RegisterEvent(NewEvent);
+    }
+}
+
+void UActorIOSubsystemBase::RegisterNativeFunctionsForObject(AActor* InObject, FActorIOFunctionList& FunctionRegistry)
+{
+    const FClassRegistrations& Registrations = GetRegistrationsForClass(InObject->GetClass());
+    for (const FActorIOFunction& Function : Registrations.Functions)
+    {
+        FunctionRegistry.RegisterFunction(Function);
+    }
+}
+
+bool UActorIOSubsystemBase::RegisterStaticEventsForObject(AActor* InObject, FActorIOEventList& EventRegistry)
+{
+    const FClassRegistrations& Registrations = GetRegistrationsForClass(InObject->GetClass());
+    if (!Registrations.StaticRegistration.IsSet())
+    {
+        return false;
+    }
+
+    UActorIOClassRegistry::RegisterEvents(Registrations.StaticRegistration.GetValue(), InObject, EventRegistry);
+    return true;
+}
+
+bool UActorIOSubsystemBase::RegisterStaticFunctionsForObject(AActor* InObject, FActorIOFunctionList& FunctionRegistry)
+{
+    const FClassRegistrations& Registrations = GetRegistrationsForClass(InObject->GetClass());
+    if (!Registrations.StaticRegistration.IsSet())
+    {
+        return false;
+    }
+
+    UActorIOClassRegistry::RegisterFunctions(Registrations.StaticRegistration.GetValue(), FunctionRegistry);
+    return true;
+}
+
 void UActorIOSubsystemBase::GetGlobalNamedArguments(FActionExecutionContext& ExecutionContext)
 {
     // Make the local player pawn always accessible as an argument for all functions.
-    const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
-    ExecutionContext.SetNamedArgument(TEXT("$Player"), IsValid(PlayerPawn) ? PlayerPawn->GetPathName() : FString());
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+    ExecutionContext.SetObjectArgument(TEXT("$Player"), PlayerPawn);
 
     // Give blueprint layer a chance to add global named arguments.
     K2_GetGlobalNamedArguments();
 }
 
+void UActorIOSubsystemBase::ApplyGlobalNamedArguments(FActionExecutionContext& ExecutionContext)
+{
+    if (!CVarCacheGlobalNamedArgs.GetValueOnGameThread())
+    {
+        GetGlobalNamedArguments(ExecutionContext);
+        return;
+    }
+
+    if (!bHasCachedGlobalNamedArguments || CachedGlobalNamedArgumentsFrame != GFrameCounter)
+    {
+        // Compute the global named arguments on their own, so that the cache only has global values.
+        TMap<FString, FString> ExistingArguments = MoveTemp(ExecutionContext.NamedArguments);
+        TMap<FString, TWeakObjectPtr<UObject>> ExistingObjectArguments = MoveTemp(ExecutionContext.ObjectArguments);
+        ExecutionContext.NamedArguments.Reset();
+        ExecutionContext.ObjectArguments.Reset();
+
+        GetGlobalNamedArguments(ExecutionContext);
+
+        CachedGlobalNamedArguments = ExecutionContext.NamedArguments;
+        CachedGlobalObjectArguments = ExecutionContext.ObjectArguments;
+        CachedGlobalNamedArgumentsFrame = GFrameCounter;
+        bHasCachedGlobalNamedArguments = true;
+
+        ExecutionContext.NamedArguments = MoveTemp(ExistingArguments);
+        ExecutionContext.ObjectArguments = MoveTemp(ExistingObjectArguments);
+    }
+
+    // Global values override existing values of the same name, same as if they were set directly.
+    // A name is either a string or an object argument, so the overridden value is removed from the other list.
+    for (const TPair<FString, FString>& NamedArg : CachedGlobalNamedArguments)
+    {
+        ExecutionContext.ObjectArguments.Remove(NamedArg.Key);
+        ExecutionContext.NamedArguments.Add(NamedArg.Key, NamedArg.Value);
+    }
+    for (const TPair<FString, TWeakObjectPtr<UObject>>& ObjectArg : CachedGlobalObjectArguments)
+    {
+        ExecutionContext.NamedArguments.Remove(ObjectArg.Key);
+        ExecutionContext.ObjectArguments.Add(ObjectArg.Key, ObjectArg.Value);
+    }
+}
+
+void UActorIOSubsystemBase::InvalidateGlobalNamedArguments()
+{
+    bHasCachedGlobalNamedArguments = false;
+    CachedGlobalNamedArguments.Reset();
+    CachedGlobalObjectArguments.Reset();
+}
+
+void UActorIOSubsystemBase::OnPawnControllerChanged(APawn* Pawn, AController* Controller)
+{
+    InvalidateGlobalNamedArguments();
+}
+
 void UActorIOSubsystemBase::ProcessEvent_OnActorOverlap(AActor* OverlappedActor, AActor* OtherActor)
 {
-    ActionExecContext.SetNamedArgument(TEXT("$Actor"), IsValid(OtherActor) ? OtherActor->GetPathName() : FString());
+    ActionExecContext.SetObjectArgument(TEXT("$Actor"), OtherActor);
 }
 
 void UActorIOSubsystemBase::ProcessEvent_OnActorDestroyed(AActor* Actor, EEndPlayReason::Type EndPlayReason)
 {
-    ActionExecContext.SetNamedArgument(TEXT("$Actor"), IsValid(Actor) ? Actor->GetPathName() : FString());
+    ActionExecContext.SetObjectArgument(TEXT("$Actor"), Actor);
     if (EndPlayReason != EEndPlayReason::Destroyed)
     {
         // Abort the action if end play was not caused by destroying the actor.
@@ -24,14 +24,14 @@ void ALogicBranch::RegisterIOEvents(FActorIOEventList& EventRegistry)
 {
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicBranch::OnTrue"))
-		.SetDisplayName(LOCTEXT("LogicBranch.OnTrue", "OnTrue"))
-		.SetTooltipText(LOCTEXT("LogicBranch.OnTrueTooltip", "Event when the stored boolean value is true when 'Test' is called."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.OnTrue", "OnTrue")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.OnTrueTooltip", "Event when the stored boolean value is true when 'Test' is called.")))
 		.SetMulticastDelegate(this, &OnTrue));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicBranch::OnFalse"))
-		.SetDisplayName(LOCTEXT("LogicBranch.OnFalse", "OnFalse"))
-		.SetTooltipText(LOCTEXT("LogicBranch.OnFalseTooltip", "Event when the stored boolean value is false when 'Test' is called."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.OnFalse", "OnFalse")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.OnFalseTooltip", "Event when the stored boolean value is false when 'Test' is called.")))
 		.SetMulticastDelegate(this, &OnFalse));
 }
 
@@ -39,32 +39,32 @@ void ALogicBranch::RegisterIOFunctions(FActorIOFunctionList& FunctionRegistry)
 {
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicBranch::SetValue"))
-		.SetDisplayName(LOCTEXT("LogicBranch.SetValue", "SetValue"))
-		.SetTooltipText(LOCTEXT("LogicBranch.SetValueTooltip", "Set the boolean value without performing the comparison. Use this to hold a value for a future test."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.SetValue", "SetValue")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.SetValueTooltip", "Set the boolean value without performing the comparison. Use this to hold a value for a future test.")))
 		.SetFunction(TEXT("SetValue")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicBranch::SetValueAndTest"))
-		.SetDisplayName(LOCTEXT("LogicBranch.SetValueAndTest", "SetValueAndTest"))
-		.SetTooltipText(LOCTEXT("LogicBranch.SetValueAndTestTooltip", "Set the boolean value and test it, firing 'OnTrue' or 'OnFalse' based on the new value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.SetValueAndTest", "SetValueAndTest")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.SetValueAndTestTooltip", "Set the boolean value and test it, firing 'OnTrue' or 'OnFalse' based on the new value.")))
 		.SetFunction(TEXT("SetValueAndTest")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicBranch::Toggle"))
-		.SetDisplayName(LOCTEXT("LogicBranch.Toggle", "Toggle"))
-		.SetTooltipText(LOCTEXT("LogicBranch.ToggleTooltip", "Toggle the boolean value between true and false without performing the comparison."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.Toggle", "Toggle")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.ToggleTooltip", "Toggle the boolean value between true and false without performing the comparison.")))
 		.SetFunction(TEXT("Toggle")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicBranch::ToggleAndTest"))
-		.SetDisplayName(LOCTEXT("LogicBranch.ToggleAndTest", "ToggleAndTest"))
-		.SetTooltipText(LOCTEXT("LogicBranch.ToggleAndTestTooltip", "Toggle the boolean value and test it, firing 'OnTrue' or 'OnFalse' based on the new value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.ToggleAndTest", "ToggleAndTest")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.ToggleAndTestTooltip", "Toggle the boolean value and test it, firing 'OnTrue' or 'OnFalse' based on the new value.")))
 		.SetFunction(TEXT("ToggleAndTest")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicBranch::Test"))
-		.SetDisplayName(LOCTEXT("LogicBranch.Test", "Test"))
-		.SetTooltipText(LOCTEXT("LogicBranch.TestTooltip", "Test the boolean value and fire 'OnTrue' or 'OnFalse' based on the value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.Test", "Test")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicBranch.TestTooltip", "Test the boolean value and fire 'OnTrue' or 'OnFalse' based on the value.")))
 		.SetFunction(TEXT("Test")));
 }
 
@@ -23,104 +23,104 @@ void ALogicCase::RegisterIOEvents(FActorIOEventList& EventRegistry)
 {
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase01"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase01", "OnCase01"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase01Tooltip", "Event when the input value equals the case value at index 0."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase01", "OnCase01")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase01Tooltip", "Event when the input value equals the case value at index 0.")))
 		.SetMulticastDelegate(this, &OnCase01));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase02"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase02", "OnCase02"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase02Tooltip", "Event when the input value equals the case value at index 1."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase02", "OnCase02")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase02Tooltip", "Event when the input value equals the case value at index 1.")))
 		.SetMulticastDelegate(this, &OnCase02));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase03"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase03", "OnCase03"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase03Tooltip", "Event when the input value equals the case value at index 2."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase03", "OnCase03")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase03Tooltip", "Event when the input value equals the case value at index 2.")))
 		.SetMulticastDelegate(this, &OnCase03));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase04"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase04", "OnCase04"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase04Tooltip", "Event when the input value equals the case value at index 3."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase04", "OnCase04")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase04Tooltip", "Event when the input value equals the case value at index 3.")))
 		.SetMulticastDelegate(this, &OnCase04));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase05"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase05", "OnCase05"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase05Tooltip", "Event when the input value equals the case value at index 4."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase05", "OnCase05")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase05Tooltip", "Event when the input value equals the case value at index 4.")))
 		.SetMulticastDelegate(this, &OnCase05));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase06"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase06", "OnCase06"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase06Tooltip", "Event when the input value equals the case value at index 5."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase06", "OnCase06")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase06Tooltip", "Event when the input value equals the case value at index 5.")))
 		.SetMulticastDelegate(this, &OnCase06));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase07"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase07", "OnCase07"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase07Tooltip", "Event when the input value equals the case value at index 6."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase07", "OnCase07")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase07Tooltip", "Event when the input value equals the case value at index 6.")))
 		.SetMulticastDelegate(this, &OnCase07));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase08"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase08", "OnCase08"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase08Tooltip", "Event when the input value equals the case value at index 7."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase08", "OnCase08")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase08Tooltip", "Event when the input value equals the case value at index 7.")))
 		.SetMulticastDelegate(this, &OnCase08));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase09"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase09", "OnCase09"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase09Tooltip", "Event when the input value equals the case value at index 8."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase09", "OnCase09")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase09Tooltip", "Event when the input value equals the case value at index 8.")))
 		.SetMulticastDelegate(this, &OnCase09));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase10"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase10", "OnCase10"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase10Tooltip", "Event when the input value equals the case value at index 9."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase10", "OnCase10")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase10Tooltip", "Event when the input value equals the case value at index 9.")))
 		.SetMulticastDelegate(this, &OnCase10));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase11"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase11", "OnCase11"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase11Tooltip", "Event when the input value equals the case value at index 10."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase11", "OnCase11")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase11Tooltip", "Event when the input value equals the case value at index 10.")))
 		.SetMulticastDelegate(this, &OnCase11));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase12"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase12", "OnCase12"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase12Tooltip", "Event when the input value equals the case value at index 11."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase12", "OnCase12")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase12Tooltip", "Event when the input value equals the case value at index 11.")))
 		.SetMulticastDelegate(this, &OnCase12));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase13"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase13", "OnCase13"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase13Tooltip", "Event when the input value equals the case value at index 12."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase13", "OnCase13")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase13Tooltip", "Event when the input value equals the case value at index 12.")))
 		.SetMulticastDelegate(this, &OnCase13));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase14"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase14", "OnCase14"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase14Tooltip", "Event when the input value equals the case value at index 13."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase14", "OnCase14")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase14Tooltip", "Event when the input value equals the case value at index 13.")))
 		.SetMulticastDelegate(this, &OnCase14));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase15"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase15", "OnCase15"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase15Tooltip", "Event when the input value equals the case value at index 14."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase15", "OnCase15")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase15Tooltip", "Event when the input value equals the case value at index 14.")))
 		.SetMulticastDelegate(this, &OnCase15));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnCase16"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnCase16", "OnCase16"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnCase16Tooltip", "Event when the input value equals the case value at index 15."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase16", "OnCase16")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnCase16Tooltip", "Event when the input value equals the case value at index 15.")))
 		.SetMulticastDelegate(this, &OnCase16));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCase::OnDefault"))
-		.SetDisplayName(LOCTEXT("LogicCase.OnDefault", "OnDefault"))
-		.SetTooltipText(LOCTEXT("LogicCase.OnDefaultTooltip", "Event when the input value does not equal any of the cases."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnDefault", "OnDefault")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.OnDefaultTooltip", "Event when the input value does not equal any of the cases.")))
 		.SetMulticastDelegate(this, &OnDefault));
 }
 
@@ -128,8 +128,8 @@ void ALogicCase::RegisterIOFunctions(FActorIOFunctionList& FunctionRegistry)
 {
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicCase::Test"))
-		.SetDisplayName(LOCTEXT("LogicCase.Test", "Test"))
-		.SetTooltipText(LOCTEXT("LogicCase.TestTooltip", "Compare the value to the case values, and fire the appropriate 'OnCase' event."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.Test", "Test")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("LogicCase.TestTooltip", "Compare the value to the case values, and fire the appropriate 'OnCase' event.")))
 		.SetFunction(TEXT("Test")));
 }
 
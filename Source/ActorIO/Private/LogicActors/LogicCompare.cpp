@@ -27,26 +27,26 @@ void ALogicCompare::RegisterIOEvents(FActorIOEventList& EventRegistry)
 {
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCompare::OnEquals"))
-		.SetDisplayName(LOCTEXT("ALogicCompare.OnEquals", "OnEquals"))
-		.SetTooltipText(LOCTEXT("ALogicCompare.OnEqualsTooltip", "Event when the current value equals the compare value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.OnEquals", "OnEquals")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.OnEqualsTooltip", "Event when the current value equals the compare value.")))
 		.SetMulticastDelegate(this, &OnEquals));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCompare::OnNotEquals"))
-		.SetDisplayName(LOCTEXT("ALogicCompare.OnNotEquals", "OnNotEquals"))
-		.SetTooltipText(LOCTEXT("ALogicCompare.OnNotEqualsTooltip", "Event when the current value does not equal the compare value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.OnNotEquals", "OnNotEquals")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.OnNotEqualsTooltip", "Event when the current value does not equal the compare value.")))
 		.SetMulticastDelegate(this, &OnNotEquals));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCompare::OnLessThen"))
-		.SetDisplayName(LOCTEXT("ALogicCompare.OnLessThen", "OnLessThen"))
-		.SetTooltipText(LOCTEXT("ALogicCompare.OnLessThenTooltip", "Event when the current value is less than the compare value. Only works with numeric values!"))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.OnLessThen", "OnLessThen")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.OnLessThenTooltip", "Event when the current value is less than the compare value. Only works with numeric values!")))
 		.SetMulticastDelegate(this, &OnLessThen));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCompare::OnGreaterThen"))
-		.SetDisplayName(LOCTEXT("ALogicCompare.OnGreaterThen", "OnGreaterThen"))
-		.SetTooltipText(LOCTEXT("ALogicCompare.OnGreaterThenTooltip", "Event when the current value is greater than the compare value. Only works with numeric values!"))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.OnGreaterThen", "OnGreaterThen")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.OnGreaterThenTooltip", "Event when the current value is greater than the compare value. Only works with numeric values!")))
 		.SetMulticastDelegate(this, &OnGreaterThen));
 }
 
@@ -54,26 +54,26 @@ void ALogicCompare::RegisterIOFunctions(FActorIOFunctionList& FunctionRegistry)
 {
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicCompare::SetValue"))
-		.SetDisplayName(LOCTEXT("ALogicCompare.SetValue", "SetValue"))
-		.SetTooltipText(LOCTEXT("ALogicCompare.SetValueTooltip", "Set the current value without performing the comparison."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.SetValue", "SetValue")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.SetValueTooltip", "Set the current value without performing the comparison.")))
 		.SetFunction(TEXT("SetValue")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicCompare::SetValueAndCompare"))
-		.SetDisplayName(LOCTEXT("ALogicCompare.SetValueAndCompare", "SetValueAndCompare"))
-		.SetTooltipText(LOCTEXT("ALogicCompare.SetValueAndCompareTooltip", "Set the current value and compare it against the compare value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.SetValueAndCompare", "SetValueAndCompare")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.SetValueAndCompareTooltip", "Set the current value and compare it against the compare value.")))
 		.SetFunction(TEXT("SetValueAndCompare")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicCompare::SetCompareValue"))
-		.SetDisplayName(LOCTEXT("ALogicCompare.SetCompareValue", "SetCompareValue"))
-		.SetTooltipText(LOCTEXT("ALogicCompare.SetCompareValueTooltip", "Set the compare value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.SetCompareValue", "SetCompareValue")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.SetCompareValueTooltip", "Set the compare value.")))
 		.SetFunction(TEXT("SetCompareValue")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicCompare::Compare"))
-		.SetDisplayName(LOCTEXT("ALogicCompare.Compare", "Compare"))
-		.SetTooltipText(LOCTEXT("ALogicCompare.CompareTooltip", "Compare the current value with the compare value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.Compare", "Compare")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCompare.CompareTooltip", "Compare the current value with the compare value.")))
 		.SetFunction(TEXT("Compare")));
 }
 
@@ -26,26 +26,26 @@ void ALogicCounter::RegisterIOEvents(FActorIOEventList& EventRegistry)
 {
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCounter::OnValueChanged"))
-		.SetDisplayName(LOCTEXT("ALogicCounter.OnValueChanged", "OnValueChanged"))
-		.SetTooltipText(LOCTEXT("ALogicCounter.OnValueChangedTooltip", "Event when the current value is changed."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.OnValueChanged", "OnValueChanged")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.OnValueChangedTooltip", "Event when the current value is changed.")))
 		.SetMulticastDelegate(this, &OnValueChanged));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCounter::OnTargetValueReached"))
-		.SetDisplayName(LOCTEXT("ALogicCounter.OnTargetValueReached", "OnTargetValueReached"))
-		.SetTooltipText(LOCTEXT("ALogicCounter.OnTargetValueReachedeTooltip", "Event when the current value equals or greater then the target value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.OnTargetValueReached", "OnTargetValueReached")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.OnTargetValueReachedeTooltip", "Event when the current value equals or greater then the target value.")))
 		.SetMulticastDelegate(this, &OnTargetValueReached));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCounter::OnTargetValueChanged"))
-		.SetDisplayName(LOCTEXT("ALogicCounter.OnTargetValueChanged", "OnTargetValueChanged"))
-		.SetTooltipText(LOCTEXT("ALogicCounter.OnTargetValueChangedTooltip", "Event when the target value is changed."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.OnTargetValueChanged", "OnTargetValueChanged")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.OnTargetValueChangedTooltip", "Event when the target value is changed.")))
 		.SetMulticastDelegate(this, &OnTargetValueChanged));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicCounter::OnGetValue"))
-		.SetDisplayName(LOCTEXT("ALogicCounter.OnGetValue", "OnGetValue"))
-		.SetTooltipText(LOCTEXT("ALogicCounter.OnGetValueTooltip", "Event when the current value is read using the 'GetValue' function."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.OnGetValue", "OnGetValue")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.OnGetValueTooltip", "Event when the current value is read using the 'GetValue' function.")))
 		.SetMulticastDelegate(this, &OnGetValue));
 }
 
@@ -53,32 +53,32 @@ void ALogicCounter::RegisterIOFunctions(FActorIOFunctionList& FunctionRegistry)
 {
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicCounter::Add"))
-		.SetDisplayName(LOCTEXT("ALogicCounter.Add", "Add"))
-		.SetTooltipText(LOCTEXT("ALogicCounter.AddTooltip", "Add to the current value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.Add", "Add")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.AddTooltip", "Add to the current value.")))
 		.SetFunction(TEXT("Add")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicCounter::Subtract"))
-		.SetDisplayName(LOCTEXT("ALogicCounter.Subtract", "Subtract"))
-		.SetTooltipText(LOCTEXT("ALogicCounter.SubtractTooltip", "Subtract from the current value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.Subtract", "Subtract")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.SubtractTooltip", "Subtract from the current value.")))
 		.SetFunction(TEXT("Subtract")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicCounter::SetValue"))
-		.SetDisplayName(LOCTEXT("ALogicCounter.SetValue", "SetValue"))
-		.SetTooltipText(LOCTEXT("ALogicCounter.SetValueTooltip", "Set the current value directly."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.SetValue", "SetValue")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.SetValueTooltip", "Set the current value directly.")))
 		.SetFunction(TEXT("SetValue")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicCounter::SetTargetValue"))
-		.SetDisplayName(LOCTEXT("ALogicCounter.SetTargetValue", "SetTargetValue"))
-		.SetTooltipText(LOCTEXT("ALogicCounter.SetTargetValueTooltip", "Set a new target value. Fires 'OnTargetValueReached' if current value equals or greater then the new target value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.SetTargetValue", "SetTargetValue")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.SetTargetValueTooltip", "Set a new target value. Fires 'OnTargetValueReached' if current value equals or greater then the new target value.")))
 		.SetFunction(TEXT("SetTargetValue")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicCounter::GetValue"))
-		.SetDisplayName(LOCTEXT("ALogicCounter.GetValue", "GetValue"))
-		.SetTooltipText(LOCTEXT("ALogicCounter.GetValueTooltip", "Fire the 'OnGetValue' event with the current value."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.GetValue", "GetValue")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicCounter.GetValueTooltip", "Fire the 'OnGetValue' event with the current value.")))
 		.SetFunction(TEXT("GetValue")));
 }
 
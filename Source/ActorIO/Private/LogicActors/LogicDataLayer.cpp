@@ -26,14 +26,14 @@ void ALogicDataLayer::RegisterIOEvents(FActorIOEventList& EventRegistry)
 {
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicDataLayer::OnDataLayerLoaded"))
-		.SetDisplayName(LOCTEXT("ALogicDataLayer.OnDataLayerLoaded", "OnDataLayerLoaded"))
-		.SetTooltipText(LOCTEXT("ALogicDataLayer.OnDataLayerLoadedTooltip", "Event when the data layer is loaded. Note that this only means the data layer is now active, but its actors are NOT streamed in yet!"))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicDataLayer.OnDataLayerLoaded", "OnDataLayerLoaded")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicDataLayer.OnDataLayerLoadedTooltip", "Event when the data layer is loaded. Note that this only means the data layer is now active, but its actors are NOT streamed in yet!")))
 		.SetMulticastDelegate(this, &OnDataLayerLoaded));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicDataLayer::OnDataLayerUnloaded"))
-		.SetDisplayName(LOCTEXT("ALogicDataLayer.OnDataLayerUnloaded", "OnDataLayerUnloaded"))
-		.SetTooltipText(LOCTEXT("ALogicDataLayer.OnDataLayerUnloadedTooltip", "Event when the data layer is unloaded."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicDataLayer.OnDataLayerUnloaded", "OnDataLayerUnloaded")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicDataLayer.OnDataLayerUnloadedTooltip", "Event when the data layer is unloaded.")))
 		.SetMulticastDelegate(this, &OnDataLayerUnloaded));
 }
 
@@ -41,14 +41,14 @@ void ALogicDataLayer::RegisterIOFunctions(FActorIOFunctionList& FunctionRegistry
 {
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicDataLayer::LoadDataLayer"))
-		.SetDisplayName(LOCTEXT("ALogicDataLayer.LoadDataLayer", "LoadDataLayer"))
-		.SetTooltipText(LOCTEXT("ALogicDataLayer.LoadDataLayerTooltip", "Load the selected data layer, and activate it. Fires 'OnDataLayerLoaded' once finished."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicDataLayer.LoadDataLayer", "LoadDataLayer")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicDataLayer.LoadDataLayerTooltip", "Load the selected data layer, and activate it. Fires 'OnDataLayerLoaded' once finished.")))
 		.SetFunction(TEXT("LoadDataLayer")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicDataLayer::UnloadDataLayer"))
-		.SetDisplayName(LOCTEXT("ALogicDataLayer.UnloadDataLayer", "UnloadDataLayer"))
-		.SetTooltipText(LOCTEXT("ALogicDataLayer.UnloadDataLayerTooltip", "Unload the selected data layer. Fires 'OnDataLayerUnloaded' once finished."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicDataLayer.UnloadDataLayer", "UnloadDataLayer")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicDataLayer.UnloadDataLayerTooltip", "Unload the selected data layer. Fires 'OnDataLayerUnloaded' once finished.")))
 		.SetFunction(TEXT("UnloadDataLayer")));
 }
 
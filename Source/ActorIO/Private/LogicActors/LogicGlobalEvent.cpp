@@ -29,26 +29,26 @@ void ALogicGlobalEvent::RegisterIOEvents(FActorIOEventList& EventRegistry)
 {
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicGlobalEvent::OnWorldInitialized"))
-		.SetDisplayName(LOCTEXT("ALogicGlobalEvent.OnWorldInitialized", "OnWorldInitialized"))
-		.SetTooltipText(LOCTEXT("ALogicGlobalEvent.OnWorldInitializedTooltip", "Event when the game world is initialized. Only called once, after loading the persistent level, before 'BeginPlay' is dispatched."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicGlobalEvent.OnWorldInitialized", "OnWorldInitialized")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicGlobalEvent.OnWorldInitializedTooltip", "Event when the game world is initialized. Only called once, after loading the persistent level, before 'BeginPlay' is dispatched.")))
 		.SetMulticastDelegate(this, &OnWorldInitialized));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicGlobalEvent::OnBeginPlay"))
-		.SetDisplayName(LOCTEXT("ALogicGlobalEvent.OnBeginPlay", "OnBeginPlay"))
-		.SetTooltipText(LOCTEXT("ALogicGlobalEvent.OnBeginPlayTooltip", "Event when 'BeginPlay' is called for this actor."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicGlobalEvent.OnBeginPlay", "OnBeginPlay")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicGlobalEvent.OnBeginPlayTooltip", "Event when 'BeginPlay' is called for this actor.")))
 		.SetMulticastDelegate(this, &OnActorBeginPlay));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicGlobalEvent::OnEndPlay"))
-		.SetDisplayName(LOCTEXT("ALogicGlobalEvent.OnEndPlay", "OnEndPlay"))
-		.SetTooltipText(LOCTEXT("ALogicGlobalEvent.OnEndPlayTooltip", "Event when 'EndPlay' is called for this actor."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicGlobalEvent.OnEndPlay", "OnEndPlay")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicGlobalEvent.OnEndPlayTooltip", "Event when 'EndPlay' is called for this actor.")))
 		.SetMulticastDelegate(this, &OnActorEndPlay));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicGlobalEvent::OnWorldTeardown"))
-		.SetDisplayName(LOCTEXT("ALogicGlobalEvent.OnWorldTeardown", "OnWorldTeardown"))
-		.SetTooltipText(LOCTEXT("ALogicGlobalEvent.OnWorldTeardownTooltip", "Event when the game world is being torn down. This means we are leaving the map. Called before 'EndPlay' is dispatched to all actors."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicGlobalEvent.OnWorldTeardown", "OnWorldTeardown")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicGlobalEvent.OnWorldTeardownTooltip", "Event when the game world is being torn down. This means we are leaving the map. Called before 'EndPlay' is dispatched to all actors.")))
 		.SetMulticastDelegate(this, &OnWorldTeardown));
 }
 
@@ -56,8 +56,8 @@ void ALogicGlobalEvent::RegisterIOFunctions(FActorIOFunctionList& FunctionRegist
 {
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicGlobalEvent::CallLevelBlueprintFunction"))
-		.SetDisplayName(LOCTEXT("ALogicGlobalEvent.CallLevelBlueprintFunction", "CallLevelBlueprintFunction"))
-		.SetTooltipText(LOCTEXT("ALogicGlobalEvent.CallLevelBlueprintFunctionTooltip", "Call a function on the level blueprint of the level. Can pass in function params in following format: \"FuncName Param1 Param2 Param3 ...\""))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicGlobalEvent.CallLevelBlueprintFunction", "CallLevelBlueprintFunction")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicGlobalEvent.CallLevelBlueprintFunctionTooltip", "Call a function on the level blueprint of the level. Can pass in function params in following format: \"FuncName Param1 Param2 Param3 ...\"")))
 		.SetFunction(TEXT("CallLevelBlueprintFunction")));
 }
 
@@ -22,8 +22,8 @@ void ALogicRelay::RegisterIOEvents(FActorIOEventList& EventRegistry)
 {
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicRelay::OnTrigger"))
-		.SetDisplayName(LOCTEXT("ALogicRelay.OnTrigger", "OnTrigger"))
-		.SetTooltipText(LOCTEXT("ALogicRelay.OnTriggerTooltip", "Event when the relay is triggered."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicRelay.OnTrigger", "OnTrigger")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicRelay.OnTriggerTooltip", "Event when the relay is triggered.")))
 		.SetMulticastDelegate(this, &OnTrigger));
 }
 
@@ -31,20 +31,20 @@ void ALogicRelay::RegisterIOFunctions(FActorIOFunctionList& FunctionRegistry)
 {
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicRelay::Trigger"))
-		.SetDisplayName(LOCTEXT("ALogicRelay.Trigger", "Trigger"))
-		.SetTooltipText(LOCTEXT("ALogicRelay.TriggerTooltip", "Trigger the relay, causing the 'OnTrigger' event to fire if enabled."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicRelay.Trigger", "Trigger")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicRelay.TriggerTooltip", "Trigger the relay, causing the 'OnTrigger' event to fire if enabled.")))
 		.SetFunction(TEXT("Trigger")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicRelay::Enable"))
-		.SetDisplayName(LOCTEXT("ALogicRelay.Enable", "Enable"))
-		.SetTooltipText(LOCTEXT("ALogicRelay.EnableTooltip", "Allow the relay to fire the 'OnTrigger' event."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicRelay.Enable", "Enable")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicRelay.EnableTooltip", "Allow the relay to fire the 'OnTrigger' event.")))
 		.SetFunction(TEXT("Enable")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicRelay::Disable"))
-		.SetDisplayName(LOCTEXT("ALogicRelay.Disable", "Disable"))
-		.SetTooltipText(LOCTEXT("ALogicRelay.DisableTooltip", "Prevent the relay from firing the 'OnTrigger' event."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicRelay.Disable", "Disable")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicRelay.DisableTooltip", "Prevent the relay from firing the 'OnTrigger' event.")))
 		.SetFunction(TEXT("Disable")));
 }
 
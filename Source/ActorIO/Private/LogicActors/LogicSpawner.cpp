@@ -27,21 +27,21 @@ void ALogicSpawner::RegisterIOEvents(FActorIOEventList& EventRegistry)
 {
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicSpawner::OnActorSpawned"))
-		.SetDisplayName(LOCTEXT("ALogicSpawner.OnActorSpawned", "OnActorSpawned"))
-		.SetTooltipText(LOCTEXT("ALogicSpawner.OnActorSpawnedTooltip", "Event whenever a new actor is spawned."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.OnActorSpawned", "OnActorSpawned")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.OnActorSpawnedTooltip", "Event whenever a new actor is spawned.")))
 		.SetMulticastDelegate(this, &OnActorSpawned)
 		.SetEventProcessor(this, TEXT("ProcessEvent_OnActorSpawned")));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicSpawner::OnSpawnFinished"))
-		.SetDisplayName(LOCTEXT("ALogicSpawner.OnSpawnFinished", "OnSpawnFinished"))
-		.SetTooltipText(LOCTEXT("ALogicSpawner.OnSpawnFinishedTooltip", "Event when all actors have finished spawning."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.OnSpawnFinished", "OnSpawnFinished")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.OnSpawnFinishedTooltip", "Event when all actors have finished spawning.")))
 		.SetMulticastDelegate(this, &OnSpawnFinished));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicSpawner::OnGetSpawnedActor"))
-		.SetDisplayName(LOCTEXT("ALogicSpawner.OnGetSpawnedActor", "OnGetSpawnedActor"))
-		.SetTooltipText(LOCTEXT("ALogicSpawner.OnGetSpawnedActorTooltip", "Event when getting a spawned actor using the 'GetSpawnedActorForEntry' function."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.OnGetSpawnedActor", "OnGetSpawnedActor")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.OnGetSpawnedActorTooltip", "Event when getting a spawned actor using the 'GetSpawnedActorForEntry' function.")))
 		.SetMulticastDelegate(this, &OnGetSpawnedActor)
 		.SetEventProcessor(this, TEXT("ProcessEvent_OnGetSpawnedActor")));
 }
@@ -50,26 +50,26 @@ void ALogicSpawner::RegisterIOFunctions(FActorIOFunctionList& FunctionRegistry)
 {
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicSpawner::SpawnActors"))
-		.SetDisplayName(LOCTEXT("ALogicSpawner.SpawnActors", "SpawnActors"))
-		.SetTooltipText(LOCTEXT("ALogicSpawner.SpawnTooltip", "Spawn the actors."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.SpawnActors", "SpawnActors")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.SpawnTooltip", "Spawn the actors.")))
 		.SetFunction(TEXT("SpawnActors")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicSpawner::DestroySpawnedActors"))
-		.SetDisplayName(LOCTEXT("ALogicSpawner.DestroySpawnedActors", "DestroySpawnedActors"))
-		.SetTooltipText(LOCTEXT("ALogicSpawner.DestroySpawnedActorsTooltip", "Destroy all spawned actors."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.DestroySpawnedActors", "DestroySpawnedActors")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.DestroySpawnedActorsTooltip", "Destroy all spawned actors.")))
 		.SetFunction(TEXT("DestroySpawnedActors")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicSpawner::DestroySpawnedActorForEntry"))
-		.SetDisplayName(LOCTEXT("ALogicSpawner.DestroySpawnedActorForEntry", "DestroySpawnedActorForEntry"))
-		.SetTooltipText(LOCTEXT("ALogicSpawner.DestroySpawnedActorForEntryTooltip", "Destroy the actor that was spawned for the given entry."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.DestroySpawnedActorForEntry", "DestroySpawnedActorForEntry")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.DestroySpawnedActorForEntryTooltip", "Destroy the actor that was spawned for the given entry.")))
 		.SetFunction(TEXT("DestroySpawnedActorForEntry")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicSpawner::GetSpawnedActorForEntry"))
-		.SetDisplayName(LOCTEXT("ALogicSpawner.GetSpawnedActorForEntry", "GetSpawnedActorForEntry"))
-		.SetTooltipText(LOCTEXT("ALogicSpawner.GetSpawnedActorForEntryTooltip", "Get the actor that was spawned for the given entry and fire 'OnGetSpawnedActor' event."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.GetSpawnedActorForEntry", "GetSpawnedActorForEntry")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicSpawner.GetSpawnedActorForEntryTooltip", "Get the actor that was spawned for the given entry and fire 'OnGetSpawnedActor' event.")))
 		.SetFunction(TEXT("GetSpawnedActorForEntry")));
 }
 
@@ -166,13 +166,13 @@ int32 ALogicSpawner::GetSpawnedActorCount() const
 void ALogicSpawner::ProcessEvent_OnActorSpawned(AActor* ActorPtr)
 {
 	FActionExecutionContext& ExecContext = FActionExecutionContext::Get(this);
-	ExecContext.SetNamedArgument(TEXT("$Actor"), IsValid(ActorPtr) ? ActorPtr->GetPathName() : FString());
+	ExecContext.SetObjectArgument(TEXT("$Actor"), ActorPtr);
 }
 
 void ALogicSpawner::ProcessEvent_OnGetSpawnedActor(AActor* ActorPtr)
 {
 	FActionExecutionContext& ExecContext = FActionExecutionContext::Get(this);
-	ExecContext.SetNamedArgument(TEXT("$Actor"), IsValid(ActorPtr) ? ActorPtr->GetPathName() : FString());
+	ExecContext.SetObjectArgument(TEXT("$Actor"), ActorPtr);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -35,15 +35,15 @@ void ALogicTimeline::RegisterIOEvents(FActorIOEventList& EventRegistry)
 {
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicTimeline::OnValueChanged"))
-		.SetDisplayName(LOCTEXT("ALogicTimeline.OnValueChanged", "OnValueChanged"))
-		.SetTooltipText(LOCTEXT("ALogicTimeline.OnValueChangedTooltip", "Event when the timeline's value is changed."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.OnValueChanged", "OnValueChanged")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.OnValueChangedTooltip", "Event when the timeline's value is changed.")))
 		.SetMulticastDelegate(this, &OnTimelineValueChanged)
 		.SetEventProcessor(this, TEXT("ProcessEvent_OnTimelineValueChanged")));
 
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicTimeline::OnFinished"))
-		.SetDisplayName(LOCTEXT("ALogicTimeline.OnFinished", "OnFinished"))
-		.SetTooltipText(LOCTEXT("ALogicTimeline.OnFinishedTooltip", "Event when the timeline is finished."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.OnFinished", "OnFinished")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.OnFinishedTooltip", "Event when the timeline is finished.")))
 		.SetMulticastDelegate(this, &OnTimelineFinished));
 }
 
@@ -51,32 +51,32 @@ void ALogicTimeline::RegisterIOFunctions(FActorIOFunctionList& FunctionRegistry)
 {
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicTimeline::Play"))
-		.SetDisplayName(LOCTEXT("ALogicTimeline.Play", "Play"))
-		.SetTooltipText(LOCTEXT("ALogicTimeline.PlayTooltip", "Start the timeline."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.Play", "Play")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.PlayTooltip", "Start the timeline.")))
 		.SetFunction(TEXT("Play")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicTimeline::PlayFromStart"))
-		.SetDisplayName(LOCTEXT("ALogicTimeline.PlayFromStart", "PlayFromStart"))
-		.SetTooltipText(LOCTEXT("ALogicTimeline.PlayFromStartTooltip", "Start the timeline from the start."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.PlayFromStart", "PlayFromStart")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.PlayFromStartTooltip", "Start the timeline from the start.")))
 		.SetFunction(TEXT("PlayFromStart")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicTimeline::Reverse"))
-		.SetDisplayName(LOCTEXT("ALogicTimeline.Reverse", "Reverse"))
-		.SetTooltipText(LOCTEXT("ALogicTimeline.ReverseTooltip", "Reverse the timeline."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.Reverse", "Reverse")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.ReverseTooltip", "Reverse the timeline.")))
 		.SetFunction(TEXT("Reverse")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicTimeline::ReverseFromEnd"))
-		.SetDisplayName(LOCTEXT("ALogicTimeline.ReverseFromEnd", "ReverseFromEnd"))
-		.SetTooltipText(LOCTEXT("ALogicTimeline.ReverseFromEndTooltip", "Reverse the timeline from the end."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.ReverseFromEnd", "ReverseFromEnd")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.ReverseFromEndTooltip", "Reverse the timeline from the end.")))
 		.SetFunction(TEXT("ReverseFromEnd")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicTimeline::Stop"))
-		.SetDisplayName(LOCTEXT("ALogicTimeline.Stop", "Stop"))
-		.SetTooltipText(LOCTEXT("ALogicTimeline.StopTooltip", "Stop the timeline."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.Stop", "Stop")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimeline.StopTooltip", "Stop the timeline.")))
 		.SetFunction(TEXT("Stop")));
 }
 
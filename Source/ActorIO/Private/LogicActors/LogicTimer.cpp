@@ -31,8 +31,8 @@ void ALogicTimer::RegisterIOEvents(FActorIOEventList& EventRegistry)
 {
 	EventRegistry.RegisterEvent(FActorIOEvent()
 		.SetId(TEXT("ALogicTimer::OnTimer"))
-		.SetDisplayName(LOCTEXT("ALogicTimer.OnTimer", "OnTimer"))
-		.SetTooltipText(LOCTEXT("ALogicTimer.OnTimerTooltip", "Event when the timer expires."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimer.OnTimer", "OnTimer")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimer.OnTimerTooltip", "Event when the timer expires.")))
 		.SetMulticastDelegate(this, &OnTimer));
 }
 
@@ -40,20 +40,20 @@ void ALogicTimer::RegisterIOFunctions(FActorIOFunctionList& FunctionRegistry)
 {
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicTimer::StartTimer"))
-		.SetDisplayName(LOCTEXT("ALogicTimer.StartTimer", "StartTimer"))
-		.SetTooltipText(LOCTEXT("ALogicTimer.StartTimerTooltip", "Start the timer. If the timer is already active then it will be restarted."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimer.StartTimer", "StartTimer")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimer.StartTimerTooltip", "Start the timer. If the timer is already active then it will be restarted.")))
 		.SetFunction(TEXT("StartTimer")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicTimer::StartTimerWithParams"))
-		.SetDisplayName(LOCTEXT("ALogicTimer.StartTimerWithParams", "StartTimerWithParams"))
-		.SetTooltipText(LOCTEXT("ALogicTimer.StartTimerWithParamsTooltip", "Start the timer with custom params. If the timer is already active then it will be restarted."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimer.StartTimerWithParams", "StartTimerWithParams")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimer.StartTimerWithParamsTooltip", "Start the timer with custom params. If the timer is already active then it will be restarted.")))
 		.SetFunction(TEXT("StartTimerWithParams")));
 
 	FunctionRegistry.RegisterFunction(FActorIOFunction()
 		.SetId(TEXT("ALogicTimer::StopTimer"))
-		.SetDisplayName(LOCTEXT("ALogicTimer.StopTimer", "StopTimer"))
-		.SetTooltipText(LOCTEXT("ALogicTimer.StopTimerTooltip", "Stop the timer if it is active."))
+		.SetDisplayName(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimer.StopTimer", "StopTimer")))
+		.SetTooltipText(ACTORIO_EDITOR_TEXT(LOCTEXT("ALogicTimer.StopTimerTooltip", "Stop the timer if it is active.")))
 		.SetFunction(TEXT("StopTimer")));
 }
 
@@ -12,6 +12,7 @@
 
 class UActorIOAction;
 class UObject;
+class FMulticastDelegateProperty;
 
 /** Actor I/O log category. */
 ACTORIO_API DECLARE_LOG_CATEGORY_EXTERN(LogActorIO, Log, All);
@@ -22,6 +23,22 @@ ACTORIO_API DECLARE_LOG_CATEGORY_EXTERN(LogActorIO, Log, All);
 /** Prefix to identify named arguments with. */
 #define NAMEDARGUMENT_PREFIX TEXT("$")
 
+/**
+ * Prefix of the placeholders that typed object arguments are replaced with in I/O messages, followed by the index of the object slot.
+ * A control character, so that it cannot appear in arguments typed in the editor.
+ */
+#define OBJECTARGUMENT_PREFIX TEXT("\x01")
+
+/**
+ * Wraps editor only texts of I/O events and functions, e.g. ACTORIO_EDITOR_TEXT(LOCTEXT("Key", "Text")).
+ * Display names and tooltips are only stored with editor only data, so in other builds the text is never constructed.
+ */
+#if WITH_EDITORONLY_DATA
+#define ACTORIO_EDITOR_TEXT(InText) InText
+#else
+#define ACTORIO_EDITOR_TEXT(InText) FText::GetEmpty()
+#endif
+
 /**
  * Exposes a dynamic delegate to the I/O system (e.g. OnTriggerEnter, OnValueChanged).
  * Actions bound to this event will be executed when the assigned delegate is triggered.
@@ -44,11 +61,13 @@ struct ACTORIO_API FActorIOEvent
 	/** Unique id of the event on a per class basis. */
 	FName EventId;
 
+#if WITH_EDITORONLY_DATA
 	/** Display name to use in the editor. If empty, event id will be used. */
 	FText DisplayName;
 
 	/** Tooltip text to display in the editor. */
 	FText TooltipText;
+#endif
 
 	/** The owner of the assigned delegate. */
 	TWeakObjectPtr<UObject> DelegateOwner;
@@ -75,8 +94,10 @@ struct ACTORIO_API FActorIOEvent
 	/** Default constructor. */
 	FActorIOEvent() :
 		EventId(NAME_None),
+#if WITH_EDITORONLY_DATA
 		DisplayName(FText::GetEmpty()),
 		TooltipText(FText::GetEmpty()),
+#endif
 		DelegateOwner(nullptr),
 		DelegateType(FActorIOEvent::Type::Null),
 		MulticastDelegatePtr(nullptr),
@@ -95,17 +116,27 @@ struct ACTORIO_API FActorIOEvent
 		return *this;
 	}
 
-	/** Set the display name to use in the editor. If empty, event id will be used. */
+	/**
+	 * Set the display name to use in the editor. If empty, event id will be used.
+	 * Only stored with editor only data, use ACTORIO_EDITOR_TEXT to avoid constructing the text in other builds.
+	 */
 	FActorIOEvent& SetDisplayName(const FText& InDisplayName)
 	{
+#if WITH_EDITORONLY_DATA
 		DisplayName = InDisplayName;
+#endif
 		return *this;
 	}
 
-	/** Set the tooltip text to use in the editor. */
+	/**
+	 * Set the tooltip text to use in the editor.
+	 * Only stored with editor only data, use ACTORIO_EDITOR_TEXT to avoid constructing the text in other builds.
+	 */
 	FActorIOEvent& SetTooltipText(const FText& InTooltipText)
 	{
+#if WITH_EDITORONLY_DATA
 		TooltipText = InTooltipText;
+#endif
 		return *this;
 	}
 
@@ -160,6 +191,96 @@ struct ACTORIO_API FActorIOEvent
 	}
 };
 
+/**
+ * Open addressing hash index over the ids of an I/O registry, kept alongside the array of elements.
+ * The array keeps the registration order for display in the editor, while lookups by id are O(1).
+ * Small registries are searched linearly, since that is faster than hashing for a handful of elements.
+ * The index can't detect elements that were replaced or reordered, so the owning list must be the only one modifying the array.
+ */
+template<typename ElementType, FName ElementType::*IdMember>
+struct TActorIORegistryIndex
+{
+	/** Registries with at most this many elements are not indexed. */
+	static constexpr int32 LinearSearchThreshold = 8;
+
+	/** Hash slots storing element indices, or INDEX_NONE for empty slots. Size is always a power of two. */
+	TArray<int32> Slots;
+
+	/** Number of elements the slots were built for. If it differs from the element count, the index is out of date. */
+	int32 NumIndexed = 0;
+
+	/** @return Index of the element with the given id, or INDEX_NONE if not found. */
+	int32 Find(const TArray<ElementType>& Elements, FName InId) const
+	{
+		if (Elements.Num() <= LinearSearchThreshold || NumIndexed != Elements.Num())
+		{
+			return Elements.IndexOfByPredicate([InId](const ElementType& Element) { return Element.*IdMember == InId; });
+		}
+
+		const uint32 SlotMask = Slots.Num() - 1;
+		for (uint32 SlotIdx = GetTypeHash(InId) & SlotMask; Slots[SlotIdx] != INDEX_NONE; SlotIdx = (SlotIdx + 1) & SlotMask)
+		{
+			if (Elements[Slots[SlotIdx]].*IdMember == InId)
+			{
+				return Slots[SlotIdx];
+			}
+		}
+
+		return INDEX_NONE;
+	}
+
+	/** Add the last element of the array to the index. Must be called after every element added to the array. */
+	void Add(const TArray<ElementType>& Elements)
+	{
+		if (Elements.Num() <= LinearSearchThreshold)
+		{
+			return;
+		}
+
+		// Keep the load factor at or below one half, so probe sequences stay short.
+		if (NumIndexed != Elements.Num() - 1 || Elements.Num() * 2 > Slots.Num())
+		{
+			Rebuild(Elements);
+			return;
+		}
+
+		Insert(Elements, Elements.Num() - 1);
+		NumIndexed = Elements.Num();
+	}
+
+	/** Rebuild the index from scratch. */
+	void Rebuild(const TArray<ElementType>& Elements)
+	{
+		NumIndexed = Elements.Num();
+		if (Elements.Num() <= LinearSearchThreshold)
+		{
+			Slots.Reset();
+			return;
+		}
+
+		Slots.Init(INDEX_NONE, static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(Elements.Num() * 4))));
+		for (int32 ElementIdx = 0; ElementIdx != Elements.Num(); ++ElementIdx)
+		{
+			Insert(Elements, ElementIdx);
+		}
+	}
+
+private:
+
+	/** Insert an element into the first free slot of its probe sequence. */
+	void Insert(const TArray<ElementType>& Elements, int32 ElementIdx)
+	{
+		const uint32 SlotMask = Slots.Num() - 1;
+		uint32 SlotIdx = GetTypeHash(Elements[ElementIdx].*IdMember) & SlotMask;
+		while (Slots[SlotIdx] != INDEX_NONE)
+		{
+			SlotIdx = (SlotIdx + 1) & SlotMask;
+		}
+
+		Slots[SlotIdx] = ElementIdx;
+	}
+};
+
 /**
  * List of I/O events registered with an object.
  * Use the register function to add elements to the list.
@@ -169,13 +290,20 @@ struct ACTORIO_API FActorIOEventList
 {
 	GENERATED_BODY()
 
+private:
+
 	/**
 	 * The internal list of I/O events.
-	 * Do not modify directly, use RegisterEvent() instead.
+	 * Only modified by RegisterEvent(), which keeps the hash index in sync. Use GetEvents() to read it.
 	 */
 	UPROPERTY()
 	TArray<FActorIOEvent> EventRegistry;
 
+	/** Hash index over the ids of the registered events. */
+	TActorIORegistryIndex<FActorIOEvent, &FActorIOEvent::EventId> EventIndex;
+
+public:
+
 	/** Default constructor. */
 	FActorIOEventList() :
 		EventRegistry(TArray<FActorIOEvent>())
@@ -184,34 +312,104 @@ struct ACTORIO_API FActorIOEventList
 	/** Constructor starting with a list of I/O events. */
 	FActorIOEventList(const TArray<FActorIOEvent>& InEvents) :
 		EventRegistry(InEvents)
-	{}
+	{
+		EventIndex.Rebuild(EventRegistry);
+	}
 
 	/** Add a new I/O event to the list. */
 	void RegisterEvent(const FActorIOEvent& InEvent)
 	{
-		const FActorIOEvent* ExistingEvent = EventRegistry.FindByKey(InEvent.EventId);
-		if (ExistingEvent)
+		if (EventIndex.Find(EventRegistry, InEvent.EventId) != INDEX_NONE)
 		{
 			UE_LOG(LogActorIO, Error, TEXT("Could not register I/O event '%s' - An event with the same id already exists!"), *InEvent.EventId.ToString());
 			return;
 		}
 
 		EventRegistry.Add(InEvent);
+		EventIndex.Add(EventRegistry);
+	}
+
+	/** @return The registered I/O events, in registration order. */
+	const TArray<FActorIOEvent>& GetEvents() const
+	{
+		return EventRegistry;
 	}
 
-	/** Attempt to get a registered I/O event by id. */
+	/**
+	 * Attempt to get a registered I/O event by id.
+	 * The id of the returned event must not be changed, since the hash index would no longer find it.
+	 */
 	FActorIOEvent* GetEvent(FName InEventId)
 	{
-		return EventRegistry.FindByKey(InEventId);
+		const int32 EventIdx = EventIndex.Find(EventRegistry, InEventId);
+		return EventIdx != INDEX_NONE ? &EventRegistry[EventIdx] : nullptr;
 	}
 
 	/** Attempt to get a registered I/O event by id (const version). */
 	const FActorIOEvent* GetEvent(FName InEventId) const
 	{
-		return EventRegistry.FindByKey(InEventId);
+		const int32 EventIdx = EventIndex.Find(EventRegistry, InEventId);
+		return EventIdx != INDEX_NONE ? &EventRegistry[EventIdx] : nullptr;
 	}
 };
 
+/**
+ * The delegate of an I/O event resolved to its actual storage.
+ * Resolving a sparse or blueprint delegate requires a lookup by name, so when binding multiple actions
+ * to the same I/O event, the delegate should be resolved once and reused for all of them.
+ */
+struct ACTORIO_API FActorIOEventBinding
+{
+	/** The owner of the resolved delegate. */
+	UObject* DelegateOwner;
+
+	/** The type of the resolved delegate. */
+	FActorIOEvent::Type DelegateType;
+
+	/** The resolved multicast script delegate. Only set for multicast delegates. */
+	FMulticastScriptDelegate* MulticastDelegatePtr;
+
+	/** The resolved sparse delegate. Only set for sparse delegates. */
+	FSparseDelegate* SparseDelegatePtr;
+
+	/** Name of the resolved sparse delegate. Required when adding to the delegate. */
+	FName SparseDelegateName;
+
+	/** The resolved event dispatcher property. Only set for blueprint delegates. */
+	FMulticastDelegateProperty* DelegatePropertyPtr;
+
+	/** Default constructor. */
+	FActorIOEventBinding() :
+		DelegateOwner(nullptr),
+		DelegateType(FActorIOEvent::Type::Null),
+		MulticastDelegatePtr(nullptr),
+		SparseDelegatePtr(nullptr),
+		SparseDelegateName(NAME_None),
+		DelegatePropertyPtr(nullptr)
+	{}
+
+	/**
+	 * Resolve the delegate of the given I/O event.
+	 *
+	 * @param InEvent The I/O event to resolve.
+	 * @param bEvenIfPendingKill Whether to resolve the delegate even if its owner is pending kill (e.g. when unbinding).
+	 * @return Whether the delegate was resolved.
+	 */
+	bool Resolve(const FActorIOEvent& InEvent, bool bEvenIfPendingKill = false);
+
+	/** @return Whether the binding points to a valid delegate. */
+	bool IsResolved() const;
+
+	/** Add a function to the resolved delegate. */
+	void AddDelegate(const FScriptDelegate& InDelegate) const;
+
+	/** Remove a function from the resolved delegate. */
+	void RemoveDelegate(const FScriptDelegate& InDelegate) const;
+
+	/** @return Description of why the delegate of the given I/O event could not be resolved. */
+	static FString GetResolveErrorReason(const FActorIOEvent& InEvent, bool bEvenIfPendingKill = false);
+};
+
 /**
  * Exposes a callable function to the I/O system (e.g. SetValue, PlayEffect, DestroyActor).
  * These functions will be called by actions when their event is triggered.
@@ -225,11 +423,13 @@ struct ACTORIO_API FActorIOFunction
 	/** Unique id of the function on a per class basis. */
 	FName FunctionId;
 
+#if WITH_EDITORONLY_DATA
 	/** Display name to use in the editor. If empty, function id will be used. */
 	FText DisplayName;
 
 	/** Tooltip text to display in the editor. */
 	FText TooltipText;
+#endif
 
 	/**
 	 * The name of the function to execute.
@@ -246,8 +446,10 @@ struct ACTORIO_API FActorIOFunction
 	/** Default constructor. */
 	FActorIOFunction() :
 		FunctionId(NAME_None),
+#if WITH_EDITORONLY_DATA
 		DisplayName(FText::GetEmpty()),
 		TooltipText(FText::GetEmpty()),
+#endif
 		FunctionToExec(FString()),
 		TargetSubobject(NAME_None)
 	{}
@@ -262,17 +464,27 @@ struct ACTORIO_API FActorIOFunction
 		return *this;
 	}
 
-	/** Set the display name to use in the editor. If empty, function id will be used. */
+	/**
+	 * Set the display name to use in the editor. If empty, function id will be used.
+	 * Only stored with editor only data, use ACTORIO_EDITOR_TEXT to avoid constructing the text in other builds.
+	 */
 	FActorIOFunction& SetDisplayName(const FText& InDisplayName)
 	{
+#if WITH_EDITORONLY_DATA
 		DisplayName = InDisplayName;
+#endif
 		return *this;
 	}
 
-	/** Set the tooltip text to use in the editor. */
+	/**
+	 * Set the tooltip text to use in the editor.
+	 * Only stored with editor only data, use ACTORIO_EDITOR_TEXT to avoid constructing the text in other builds.
+	 */
 	FActorIOFunction& SetTooltipText(const FText& InTooltipText)
 	{
+#if WITH_EDITORONLY_DATA
 		TooltipText = InTooltipText;
+#endif
 		return *this;
 	}
 
@@ -319,13 +531,20 @@ struct ACTORIO_API FActorIOFunctionList
 {
 	GENERATED_BODY()
 
+private:
+
 	/**
 	 * The internal list of I/O functions.
-	 * Do not modify directly, use RegisterFunction() instead.
+	 * Only modified by RegisterFunction(), which keeps the hash index in sync. Use GetFunctions() to read it.
 	 */
 	UPROPERTY()
 	TArray<FActorIOFunction> FunctionRegistry;
 
+	/** Hash index over the ids of the registered functions. */
+	TActorIORegistryIndex<FActorIOFunction, &FActorIOFunction::FunctionId> FunctionIndex;
+
+public:
+
 	/** Default constructor. */
 	FActorIOFunctionList() :
 		FunctionRegistry(TArray<FActorIOFunction>())
@@ -334,31 +553,44 @@ struct ACTORIO_API FActorIOFunctionList
 	/** Constructor starting with a list of I/O functions. */
 	FActorIOFunctionList(const TArray<FActorIOFunction>& InFunctions) :
 		FunctionRegistry(InFunctions)
-	{}
+	{
+		FunctionIndex.Rebuild(FunctionRegistry);
+	}
 
 	/** Add a new I/O function to the list. */
 	void RegisterFunction(const FActorIOFunction& InFunction)
 	{
-		const FActorIOFunction* ExistingFunction = FunctionRegistry.FindByKey(InFunction.FunctionId);
-		if (ExistingFunction)
+		if (FunctionIndex.Find(FunctionRegistry, InFunction.FunctionId) != INDEX_NONE)
 		{
 			UE_LOG(LogActorIO, Error, TEXT("Could not register I/O function '%s' - A function with the same id already exists!"), *InFunction.FunctionId.ToString());
 			return;
 		}
 
 		FunctionRegistry.Add(InFunction);
+		FunctionIndex.Add(FunctionRegistry);
 	}
 
-	/** Attempt to get a registered I/O function by id. */
+	/** @return The registered I/O functions, in registration order. */
+	const TArray<FActorIOFunction>& GetFunctions() const
+	{
+		return FunctionRegistry;
+	}
+
+	/**
+	 * Attempt to get a registered I/O function by id.
+	 * The id of the returned function must not be changed, since the hash index would no longer find it.
+	 */
 	FActorIOFunction* GetFunction(FName InFunctionId)
 	{
-		return FunctionRegistry.FindByKey(InFunctionId);
+		const int32 FunctionIdx = FunctionIndex.Find(FunctionRegistry, InFunctionId);
+		return FunctionIdx != INDEX_NONE ? &FunctionRegistry[FunctionIdx] : nullptr;
 	}
 
 	/** Attempt to get a registered I/O function by id (const version). */
 	const FActorIOFunction* GetFunction(FName InFunctionId) const
 	{
-		return FunctionRegistry.FindByKey(InFunctionId);
+		const int32 FunctionIdx = FunctionIndex.Find(FunctionRegistry, InFunctionId);
+		return FunctionIdx != INDEX_NONE ? &FunctionRegistry[FunctionIdx] : nullptr;
 	}
 };
 
@@ -393,6 +625,14 @@ struct ACTORIO_API FActionExecutionContext
 	 */
 	TMap<FString, FString> NamedArguments;
 
+	/**
+	 * List of named arguments whose values are objects.
+	 * These are passed to object parameters as pointers, instead of being converted to paths and searched for again.
+	 * A name is either in this list or in the list of string named arguments, but not both.
+	 * Do not modify directly. Use SetObjectArgument() instead.
+	 */
+	TMap<FString, TWeakObjectPtr<UObject>> ObjectArguments;
+
 	/**
 	 * Whether action execution was aborted.
 	 * This can happen either by the event processor, or the owning actor.
@@ -408,6 +648,7 @@ struct ACTORIO_API FActionExecutionContext
 		ActionPtr(nullptr),
 		ScriptParams(nullptr),
 		NamedArguments(TMap<FString, FString>()),
+		ObjectArguments(TMap<FString, TWeakObjectPtr<UObject>>()),
 		bAborted(false),
 		bProcessResult(false)
 	{}
@@ -431,6 +672,16 @@ struct ACTORIO_API FActionExecutionContext
 	 */
 	void SetNamedArgument(const FString& InName, const FString& InValue);
 
+	/**
+	 * Add a named argument with an object value to the current execution context.
+	 * The object is passed to object parameters directly. Other parameters receive the path of the object, same as before.
+	 * Should only be called from GetGlobalNamedArguments, GetLocalNamedArguments, or an I/O event processor!
+	 */
+	void SetObjectArgument(const FString& InName, UObject* InObject);
+
+	/** @return Whether the given name can be used for a named argument. Logs an error if not. */
+	static bool IsValidArgumentName(const FString& InName);
+
 	/**
 	 * Aborts action execution.
 	 * Intended to be used from an I/O event processor.
@@ -450,22 +701,38 @@ struct ACTORIO_API FActorIOMessage
 	/** The action that is sending the message. */
 	TSoftObjectPtr<UActorIOAction> SenderPtr;
 
+	/**
+	 * Stable id of the action that is sending the message.
+	 * Used to find messages of an action without resolving the sender pointer.
+	 * Only unique within a level, so it must be matched together with the level of the sender pointer.
+	 */
+	FGuid SenderId;
+
 	/** Actor to execute the message on. */
 	TSoftObjectPtr<AActor> TargetPtr;
 
 	/** Id of the I/O function to execute on the target. */
 	FName FunctionId;
 
-	/** Parameters to send to the function in UnrealScript format. */
+	/**
+	 * Parameters to send to the function in UnrealScript format.
+	 * Typed object arguments are stored as placeholders referring to ObjectArguments. @see OBJECTARGUMENT_PREFIX
+	 */
 	FString Arguments;
 
+	/** Objects of the typed object arguments, in the order of their placeholders. */
+	TArray<TWeakObjectPtr<UObject>> ObjectArguments;
+
 	/** Possible I/O message flags. */
 	enum class EMessageFlags : uint8
 	{
 		/** No flags. */
 		None = 0x00,
 
-		// Intentionally leaving 4 bit room here for future use.
+		/** Message was delivered while ticking, and is awaiting removal from the pending list. */
+		IsProcessed = 0x01,
+
+		// Intentionally leaving 3 bit room here for future use.
 
 		/** Awaiting the sender's level activate. */
 		SenderIsPending = 0x10,
@@ -486,15 +753,43 @@ struct ACTORIO_API FActorIOMessage
 	/** Default constructor. */
 	FActorIOMessage() :
 		SenderPtr(nullptr),
+		SenderId(FGuid()),
 		TargetPtr(nullptr),
 		FunctionId(NAME_None),
 		Arguments(FString()),
+		ObjectArguments(TArray<TWeakObjectPtr<UObject>>()),
 		MessageFlags(0x00),
 		TimeRemaining(0.0f)
 	{}
 
 	/** Serialize to structured archive. */
 	void SerializeMessage(FStructuredArchive::FRecord Record);
+
+	/** @return The arguments with typed object placeholders replaced by the paths of the objects. Must be called on the game thread. */
+	FString GetResolvedArguments() const { return ResolveObjectArguments(Arguments, ObjectArguments); }
+
+	/** Replace the typed object placeholders of the arguments with the paths of the objects. Must be called on the game thread. */
+	void ResolveObjectArguments()
+	{
+		if (ObjectArguments.Num() > 0)
+		{
+			Arguments = GetResolvedArguments();
+			ObjectArguments.Reset();
+		}
+	}
+
+	/** @return The given arguments with typed object placeholders replaced by the paths of the objects. Must be called on the game thread. */
+	static FString ResolveObjectArguments(const FString& InArguments, const TArray<TWeakObjectPtr<UObject>>& InObjects);
+
+	/**
+	 * Serialize a list of messages in a compact binary format.
+	 * Paths, function ids and arguments are written once into a string table, and messages only store indices into it.
+	 * Used by the I/O subsystem when saving pending messages.
+	 *
+	 * @param Version The I/O subsystem version of the data. See FActorIOSubsystemVersion.
+	 * @return False if the data was malformed when loading.
+	 */
+	static bool SerializeCompactMessages(FArchive& Ar, TArray<FActorIOMessage>& Messages, int32 Version);
 };
 
 /**
@@ -540,6 +835,14 @@ extern ACTORIO_API TAutoConsoleVariable<bool> CVarWarnAboutIOActionInvalidTarget
 extern ACTORIO_API TAutoConsoleVariable<bool> CVarLogIOActionNamedArgs;
 /** [Console Variable] Whether to log the final command sent to the target actor after executing I/O action. */
 extern ACTORIO_API TAutoConsoleVariable<bool> CVarLogIOActionFinalCommand;
+/** [Console Variable] Whether to compute global named arguments at most once per frame. */
+extern ACTORIO_API TAutoConsoleVariable<bool> CVarCacheGlobalNamedArgs;
+/** [Console Variable] Whether object named arguments are passed to object parameters as pointers. */
+extern ACTORIO_API TAutoConsoleVariable<bool> CVarTypedObjectArgs;
+/** [Console Variable] Whether to import arguments of common parameter types with specialized importers. */
+extern ACTORIO_API TAutoConsoleVariable<bool> CVarFastArgumentImport;
+/** [Console Variable] Whether to create garbage collection clusters for I/O components and their actions. */
+extern ACTORIO_API TAutoConsoleVariable<bool> CVarClusterIOComponents;
 
 /** Macro to get CVarDebugIOActions value on game thread. */
 #define DebugIOActions CVarDebugIOActions.GetValueOnGameThread()
@@ -3,11 +3,55 @@
 #pragma once
 
 #include "ActorIO.h"
+#include "ActorIOActionRegistry.h"
 #include "UObject/NoExportTypes.h"
 #include "ActorIOAction.generated.h"
 
 class UActorIOComponent;
 
+/**
+ * Plain data of an I/O action.
+ * Cooked levels can store their actions in this form, instead of as one instanced object per action.
+ * @see UActorIOSettings::bStructBackedActions
+ */
+USTRUCT()
+struct ACTORIO_API FActorIOActionData
+{
+	GENERATED_BODY()
+
+	/** Name of the action object. Kept so that the layout hash and save data of the component stay the same. */
+	UPROPERTY()
+	FName ActionName;
+
+	/** Stable id of the action. */
+	UPROPERTY()
+	FGuid ActionId;
+
+	/** Id of the I/O event to bind to. */
+	UPROPERTY()
+	FName EventId;
+
+	/** The execution target. */
+	UPROPERTY()
+	TSoftObjectPtr<AActor> TargetActor;
+
+	/** Id of the I/O function to call on the target actor. */
+	UPROPERTY()
+	FName FunctionId;
+
+	/** Parameters that are sent with the function. */
+	UPROPERTY()
+	FString FunctionArguments;
+
+	/** Time before the function is called on the target actor. */
+	UPROPERTY()
+	float Delay = 0.0f;
+
+	/** Whether the action can only be executed once. */
+	UPROPERTY()
+	bool bExecuteOnlyOnce = false;
+};
+
 /**
  * An action that is executed when the assigned I/O event is triggered.
  * When executed, it calls the designated function on the target actor with the given parameters.
@@ -56,8 +100,26 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Action")
 	bool bExecuteOnlyOnce;
 
+#if WITH_EDITORONLY_DATA
+	/**
+	 * Whether the action is always kept in cooked levels, even if it looks like it can never be executed.
+	 * @see UActorIOSettings::bStripDeadActionsOnCook
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Action")
+	bool bKeepWhenCooking;
+#endif
+
 protected:
 
+	/**
+	 * Stable id of the action. Assigned when the action is created with UActorIOComponent::CreateNewAction.
+	 * Actions saved before ids were introduced get a deterministic id based on their path when loaded.
+	 * Save data and I/O messages refer to the action by this id, instead of by name or path.
+	 * Only unique within a level, since every instance of a level that is loaded multiple times has the same ids.
+	 */
+	UPROPERTY()
+	FGuid ActionId;
+
 	/** Whether the action was executed before. */
 	bool bWasExecuted;
 
@@ -67,14 +129,89 @@ protected:
 	/** The delegate that is bound to the assigned I/O event. */
 	FScriptDelegate ActionDelegate;
 
+	/**
+	 * The event processor of the I/O event that the action is bound to.
+	 * Stored when binding the action, so that the I/O event does not need to be looked up when the action is executed.
+	 */
+	FScriptDelegate BoundEventProcessor;
+
+	/**
+	 * The owner of the delegate that the action is bound to.
+	 * Used to skip unbinding when the delegate is destroyed together with the action's owner.
+	 */
+	TWeakObjectPtr<UObject> BoundDelegateOwner;
+
+	/**
+	 * The function arguments split into tokens, ready for named argument substitution.
+	 * Tokenized the first time the action is executed, unless the tokens were already provided by the compiled logic graph.
+	 */
+	TArray<FString> ArgumentTokens;
+
+	/** Whether the argument tokens are up to date. */
+	bool bHasArgumentTokens;
+
+	/**
+	 * Whether the action triggers its target logic relay directly, instead of dispatching an I/O message.
+	 * Set from the compiled logic graph. @see UActorIOSettings::bCollapseRelayChains
+	 */
+	bool bDirectRelayTrigger;
+
+	/** Handle of the action in the action registry of the I/O subsystem. Set while the action is registered. */
+	FActorIOActionHandle RegistryHandle;
+
+#if WITH_EDITORONLY_DATA
+	/**
+	 * Whether the action is stripped from the level that is currently being cooked.
+	 * Stripped actions are treated as editor only objects, so the cooker leaves them out of the package.
+	 * This is also used for actions that are stored as plain data in the cooked level.
+	 */
+	bool bStrippedFromCook;
+#endif
+
 public:
 
 	/** Bind the action to the assigned I/O event. */
 	void BindAction();
 
+	/**
+	 * Bind the action to the given I/O event using an already resolved delegate.
+	 * Used when binding multiple actions at once, so that the I/O event and its delegate are only looked up once.
+	 */
+	void BindAction(const FActorIOEvent& TargetEvent, const FActorIOEventBinding& EventBinding);
+
 	/** Unbind the action. */
 	void UnbindAction();
 
+	/**
+	 * Unbind the action from the given I/O event using an already resolved delegate.
+	 * Used when unbinding multiple actions at once, so that the I/O event and its delegate are only looked up once.
+	 */
+	void UnbindAction(const FActorIOEvent& TargetEvent, const FActorIOEventBinding& EventBinding);
+
+	/**
+	 * Use the event dispatcher of the owning component, instead of binding the action's own delegate.
+	 * Used for plain data actions whose object is created after their I/O event was bound. @see UActorIOComponent::GetOrCreateAction
+	 */
+	void SetDispatchedBinding(const FScriptDelegate& InEventProcessor, UObject* InDelegateOwner);
+
+	/**
+	 * Execute the action with the original script memory of the I/O event, as if its own delegate was called.
+	 * Called by the event dispatcher of the owning component.
+	 */
+	void ExecuteFromDispatcher(void* Parms);
+
+	/** @return Stable id of the action. Only unique within a level. */
+	const FGuid& GetActionId() const { return ActionId; }
+
+	/** Assign a new unique id to the action. */
+	void AssignNewActionId();
+
+	/** @return Whether the action is bound to the assigned I/O event. */
+	bool IsBound() const { return bIsBound; }
+
+	/** @return The owner of the delegate that the action is bound to. Valid even if the owner is pending kill. */
+	UObject* GetBoundDelegateOwner() const { return BoundDelegateOwner.Get(true); }
+
 	/** Get the I/O component that owns this action. */
 	UFUNCTION(BlueprintPure, Category = "Action")
 	UActorIOComponent* GetOwnerIOComponent() const;
@@ -112,6 +249,71 @@ public:
 	/** @return Whether the action should be serialized when saving game data. */
 	bool ShouldSerializeToArchive(FArchive& Ar) const;
 
+	/** Provide the already tokenized function arguments of the action. Used when binding from a compiled logic graph. */
+	void SetArgumentTokens(const TArray<FString>& InTokens);
+
+	/** Set whether the action triggers its target logic relay directly. Used when binding from a compiled logic graph. */
+	void SetDirectRelayTrigger(bool bDirect) { bDirectRelayTrigger = bDirect; }
+
+	/** @return Whether the action triggers its target logic relay directly. */
+	bool IsDirectRelayTrigger() const { return bDirectRelayTrigger; }
+
+	/**
+	 * Add the action to the action registry of the I/O subsystem. Does nothing if the action is already registered.
+	 * Called automatically when the action is bound.
+	 */
+	void AddToActionRegistry();
+
+	/**
+	 * Remove the action from the action registry of the I/O subsystem.
+	 * Called automatically when the action is unbound.
+	 */
+	void RemoveFromActionRegistry();
+
+	/** Copy the editable properties and id of the action into plain data. */
+	void CopyToActionData(FActorIOActionData& OutData) const;
+
+	/** Initialize the action from plain data. Used when creating the actions of a component from struct-backed storage. */
+	void InitFromActionData(const FActorIOActionData& InData);
+
+	/** @return Handle of the action in the action registry of the I/O subsystem. */
+	const FActorIOActionHandle& GetRegistryHandle() const { return RegistryHandle; }
+
+	/**
+	 * @return Whether the action can trigger its target logic relay directly, without changing its behavior.
+	 * Requires a relay in the same level as the action, with no delay and no arguments.
+	 */
+	bool CanTriggerRelayDirectly() const;
+
+	/**
+	 * Split the function arguments into tokens that can be turned into an UnrealScript command.
+	 * Whitespaces are removed from the tokens unless they are between quotes.
+	 */
+	static void TokenizeArguments(const FString& InArguments, TArray<FString>& OutTokens);
+
+#if WITH_EDITOR
+	/**
+	 * Check whether the action can never be executed in a cooked build.
+	 * Only considers things that are known at cook time, so actions targeting actors in other levels are kept.
+	 *
+	 * @param OutReason Why the action can be stripped.
+	 * @return Whether the action can be stripped from the cooked level.
+	 */
+	bool CanBeStrippedFromCook(FString& OutReason) const;
+
+	/** Set whether the action is stripped from the level that is currently being cooked. */
+	void SetStrippedFromCook(bool bStripped) { bStrippedFromCook = bStripped; }
+
+	/** @return Whether the action is stripped from the level that is currently being cooked. */
+	bool IsStrippedFromCook() const { return bStrippedFromCook; }
+#endif
+
+	/**
+	 * Restore the executed state of the action from save data.
+	 * Recalls pending messages that were sent prematurely by an action that should only be executed once.
+	 */
+	void RestoreExecutedState(bool bExecuted);
+
 protected:
 
 	/**
@@ -137,6 +339,13 @@ protected:
 public:
 
 	//~ Begin UObject Interface
+	virtual void PostLoad() override;
+	virtual void PostDuplicate(EDuplicateMode::Type DuplicateMode) override;
+	virtual bool IsEditorOnly() const override;
+#if WITH_EDITOR
+	virtual void PostEditImport() override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 	virtual void ProcessEvent(UFunction* Function, void* Parms) override;
 	virtual void Serialize(FStructuredArchive::FRecord Record);
 	//~ End UObject Interface
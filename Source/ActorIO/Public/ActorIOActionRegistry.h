@@ -0,0 +1,141 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UActorIOAction;
+
+/**
+ * Handle of an action in the action registry.
+ * Stays valid while the action is registered, even if other actions are added or removed.
+ */
+struct FActorIOActionHandle
+{
+	/** Index of the handle slot in the registry. */
+	int32 SlotIndex = INDEX_NONE;
+
+	/** Serial number of the handle slot when the handle was created. Used to detect stale handles. */
+	uint32 Serial = 0;
+
+	/** @return Whether the handle was assigned. Does not mean that the handle is still valid in the registry. */
+	bool IsSet() const { return SlotIndex != INDEX_NONE; }
+
+	/** Clear the handle. */
+	void Reset()
+	{
+		SlotIndex = INDEX_NONE;
+		Serial = 0;
+	}
+};
+
+/** Flags of an action in the action registry. */
+enum class EActorIOActionRegistryFlags : uint8
+{
+	None = 0x00,
+	/** The action can only be executed once. */
+	ExecuteOnlyOnce = 0x01,
+	/** The action has a delay. */
+	Delayed = 0x02,
+	/** The action triggers its target logic relay directly. */
+	DirectRelayTrigger = 0x04,
+	/** The target actor was not loaded when the action was registered, or it was unloaded since. Resolved lazily when querying targets. */
+	TargetUnresolved = 0x08
+};
+ENUM_CLASS_FLAGS(EActorIOActionRegistryFlags);
+
+/**
+ * Registry of all bound actions in a world, stored as a structure of arrays.
+ * Each column is a tightly packed array with one element per action, so that queries over many actions
+ * only touch the data they need, instead of chasing pointers to action objects.
+ * Removing an action swaps the last action into its place, so the columns never have holes.
+ * Owned by the I/O subsystem, and updated when actions are bound and unbound.
+ */
+struct ACTORIO_API FActorIOActionRegistry
+{
+	/** The registered actions. */
+	TArray<TWeakObjectPtr<UActorIOAction>> Actions;
+
+	/** Owning actor of each action. */
+	TArray<FObjectKey> Owners;
+
+	/** Id of the I/O event that each action is bound to. */
+	TArray<FName> EventIds;
+
+	/**
+	 * Target actor of each action. Null if the target was not loaded, see EActorIOActionRegistryFlags::TargetUnresolved.
+	 * May point to an actor that no longer exists if the target was unloaded. Such keys are resolved again when querying targets.
+	 */
+	TArray<FObjectKey> Targets;
+
+	/** Id of the I/O function that each action calls. */
+	TArray<FName> FunctionIds;
+
+	/** Flags of each action. */
+	TArray<EActorIOActionRegistryFlags> Flags;
+
+	/** Whether each action was executed before. */
+	TBitArray<> ExecutedStates;
+
+protected:
+
+	/** Handle slot to dense index mapping. */
+	struct FHandleSlot
+	{
+		/** Index of the action in the columns. INDEX_NONE if the slot is free. */
+		int32 DenseIndex = INDEX_NONE;
+
+		/** Incremented every time the slot is freed. */
+		uint32 Serial = 1;
+	};
+
+	/** Handle slots of the registry. */
+	TArray<FHandleSlot> HandleSlots;
+
+	/** Handle slot of each action, in column order. */
+	TArray<int32> DenseToSlot;
+
+	/** Handle slots that are free for reuse. */
+	TArray<int32> FreeSlots;
+
+public:
+
+	/**
+	 * Add an action to the registry.
+	 * @return Handle of the action. Store it on the action so that it can be removed and updated later.
+	 */
+	FActorIOActionHandle Add(UActorIOAction* InAction);
+
+	/**
+	 * Remove an action from the registry.
+	 * @return Whether the handle was valid.
+	 */
+	bool Remove(const FActorIOActionHandle& InHandle);
+
+	/** Update the executed state of a registered action. */
+	void SetExecuted(const FActorIOActionHandle& InHandle, bool bExecuted);
+
+	/** @return Index of the action in the columns, or INDEX_NONE if the handle is no longer valid. */
+	int32 GetDenseIndex(const FActorIOActionHandle& InHandle) const;
+
+	/** @return Number of registered actions. */
+	int32 Num() const { return Actions.Num(); }
+
+	/**
+	 * Get the actions that target the given actor.
+	 * Targets that were not loaded when their action was registered, or were reloaded since, are resolved on the way.
+	 */
+	void GetActionsTargeting(const AActor* InActor, TArray<TWeakObjectPtr<UActorIOAction>>& OutActions);
+
+	/** @return Number of registered actions that were executed before. */
+	int32 GetNumExecuted() const;
+
+	/** Remove all actions from the registry. Handles held by actions become stale. */
+	void Reset();
+
+protected:
+
+	/** Update the columns of the action at the given index from the action object. */
+	void UpdateColumns(int32 DenseIndex, UActorIOAction* InAction);
+};
@@ -0,0 +1,37 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fast text importers for the parameter types that are most common in I/O functions.
+ * Covers bool, int32, float, double, FName, FString, enums, object paths, FVector and FLinearColor.
+ * Each importer only accepts the simple form of its type (e.g. "1.5", "true", "(X=1,Y=2,Z=3)"), and parses it without heap allocations.
+ * Anything else is left to the generic property text importer, so the result is always the same as with FProperty::ImportText_InContainer.
+ * @see CVarFastArgumentImport
+ */
+struct ACTORIO_API FActorIOArgumentImporter
+{
+	/**
+	 * Signature of a specialized importer.
+	 * @return Whether the text was imported. False if the text is not in the simple form that the importer understands.
+	 */
+	typedef bool (*FImportFunc)(const FProperty* Property, FString& Text, void* Container);
+
+	/**
+	 * Try to import the text into the given property of the container with a specialized importer.
+	 * The text may be moved from if the property is a string.
+	 *
+	 * @return Whether the text was imported. If false, the generic importer should be used instead.
+	 */
+	static bool TryImport(const FProperty* Property, FString& Text, void* Container);
+
+	/** @return Whether the given property has a specialized importer. */
+	static bool HasImporter(const FProperty* Property);
+
+protected:
+
+	/** @return Specialized importers by property class. */
+	static const TMap<FFieldClass*, FImportFunc>& GetImportTable();
+};
@@ -0,0 +1,153 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#pragma once
+
+#include "ActorIO.h"
+#include "Engine/DataAsset.h"
+#include "GameFramework/Actor.h"
+#include "ActorIOClassRegistry.generated.h"
+
+/** An I/O event that a blueprint class registered in its Register I/O Events function. */
+USTRUCT()
+struct ACTORIO_API FActorIOCapturedEvent
+{
+	GENERATED_BODY()
+
+	/** Unique id of the event. @see FActorIOEvent::EventId */
+	UPROPERTY(VisibleAnywhere, Category = "Event")
+	FName EventId;
+
+#if WITH_EDITORONLY_DATA
+	/** Display name to use in the editor. */
+	UPROPERTY(VisibleAnywhere, Category = "Event")
+	FText DisplayName;
+
+	/** Tooltip text to display in the editor. */
+	UPROPERTY(VisibleAnywhere, Category = "Event")
+	FText TooltipText;
+#endif
+
+	/** Name of the event dispatcher to assign. */
+	UPROPERTY(VisibleAnywhere, Category = "Event")
+	FName DelegateName;
+
+	/** Default subobject of the actor that owns the event dispatcher. If none, the dispatcher is owned by the actor itself. */
+	UPROPERTY(VisibleAnywhere, Category = "Event")
+	FName DelegateSubobject;
+
+	/** Name of a function on the owner of the event dispatcher to use as the event processor. Optional. */
+	UPROPERTY(VisibleAnywhere, Category = "Event")
+	FName EventProcessor;
+};
+
+/** An I/O function that a blueprint class registered in its Register I/O Functions function. */
+USTRUCT()
+struct ACTORIO_API FActorIOCapturedFunction
+{
+	GENERATED_BODY()
+
+	/** Unique id of the function. @see FActorIOFunction::FunctionId */
+	UPROPERTY(VisibleAnywhere, Category = "Function")
+	FName FunctionId;
+
+#if WITH_EDITORONLY_DATA
+	/** Display name to use in the editor. */
+	UPROPERTY(VisibleAnywhere, Category = "Function")
+	FText DisplayName;
+
+	/** Tooltip text to display in the editor. */
+	UPROPERTY(VisibleAnywhere, Category = "Function")
+	FText TooltipText;
+#endif
+
+	/** The name of the UFUNCTION to execute. */
+	UPROPERTY(VisibleAnywhere, Category = "Function")
+	FString FunctionToExec;
+
+	/** Default subobject of the actor to call the function on. If none, the function is called on the actor itself. */
+	UPROPERTY(VisibleAnywhere, Category = "Function")
+	FName TargetSubobject;
+};
+
+/** The I/O events and functions that a blueprint class registered when it was last compiled. */
+USTRUCT()
+struct ACTORIO_API FActorIOClassRegistration
+{
+	GENERATED_BODY()
+
+	/** Events registered by the blueprint. */
+	UPROPERTY(VisibleAnywhere, Category = "Registration")
+	TArray<FActorIOCapturedEvent> Events;
+
+	/** Functions registered by the blueprint. */
+	UPROPERTY(VisibleAnywhere, Category = "Registration")
+	TArray<FActorIOCapturedFunction> Functions;
+};
+
+/**
+ * Data asset with the I/O events and functions of blueprint classes, captured when the blueprints are compiled in the editor.
+ * At runtime, the I/O subsystem reads the registrations of these classes from the asset instead of calling
+ * the Register I/O Events and Register I/O Functions blueprint functions, so no script is executed.
+ * Classes that are not in the registry, or are listed as dynamic in the settings, still call the blueprint functions.
+ * Every class is captured again when the registry is cooked, and registrations that are out of date at runtime also fall back to the blueprint functions.
+ */
+UCLASS(BlueprintType, DisplayName = "Actor I/O Class Registry")
+class ACTORIO_API UActorIOClassRegistry : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Registrations of blueprint classes. */
+	UPROPERTY(VisibleAnywhere, Category = "Registry")
+	TMap<TSoftClassPtr<AActor>, FActorIOClassRegistration> Classes;
+
+public:
+
+	/** @return The captured registration of the given class, or nullptr if the class is not in the registry. */
+	const FActorIOClassRegistration* FindRegistration(UClass* InClass) const;
+
+	/** Add the captured I/O events of the given class to the list. */
+	static void RegisterEvents(const FActorIOClassRegistration& InRegistration, AActor* InObject, FActorIOEventList& EventRegistry);
+
+	/** Add the captured I/O functions of the given class to the list. */
+	static void RegisterFunctions(const FActorIOClassRegistration& InRegistration, FActorIOFunctionList& FunctionRegistry);
+
+	/**
+	 * Check that the captured registration still matches the given class, e.g. the event dispatchers it refers to still exist.
+	 * Registrations can go stale if the class was changed without recompiling the blueprint in the editor.
+	 *
+	 * @param OutReason Why the registration is stale.
+	 * @return Whether the registration can be used.
+	 */
+	static bool IsRegistrationValid(UClass* InClass, const FActorIOClassRegistration& InRegistration, FString& OutReason);
+
+#if WITH_EDITOR
+	/**
+	 * Capture the I/O events and functions that the given blueprint class registers, by calling its blueprint functions on the class default object.
+	 * If the registrations cannot be represented statically (e.g. a delegate owned by a non default subobject), the class is removed from the registry instead.
+	 *
+	 * @return Whether the registry was modified.
+	 */
+	bool CaptureClass(UClass* InClass);
+
+	/**
+	 * Remove the given class from the registry.
+	 *
+	 * @return Whether the registry was modified.
+	 */
+	bool RemoveClass(UClass* InClass);
+
+	/**
+	 * Capture every class in the registry again. Called when the registry is cooked, so that the cooked registry is never stale.
+	 * Classes that no longer exist are removed from the registry.
+	 */
+	void RecaptureClasses();
+#endif
+
+public:
+
+	//~ Begin UObject Interface
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+	//~ End UObject Interface
+};
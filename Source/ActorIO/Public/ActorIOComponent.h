@@ -3,10 +3,36 @@
 #pragma once
 
 #include "ActorIO.h"
+#include "ActorIOLogicGraph.h"
+#include "ActorIOAction.h"
 #include "Components/ActorComponent.h"
+#include "Misc/Optional.h"
 #include "ActorIOComponent.generated.h"
 
-class UActorIOAction;
+/**
+ * I/O event that the component is bound to on behalf of its plain data actions.
+ * A single delegate is bound per event, and the component dispatches the event to the actions by index. @see UActorIOComponent::DispatchEvent
+ */
+struct FActorIOEventDispatcher
+{
+	/** Id of the I/O event. */
+	FName EventId;
+
+	/** Indices of the actions bound to the event, in execution order. */
+	TArray<int32> ActionIndices;
+
+	/** The delegate that is bound to the I/O event. Not bound if the dispatch slot is free. */
+	FScriptDelegate Delegate;
+
+	/** The event processor of the I/O event. Given to action objects when they are created. */
+	FScriptDelegate EventProcessor;
+
+	/** The owner of the delegate. Used to skip unbinding when the delegate is destroyed together with the owning actor. */
+	TWeakObjectPtr<UObject> DelegateOwner;
+
+	/** @return Whether the dispatch slot is in use. */
+	bool IsBound() const { return Delegate.IsBound(); }
+};
 
 /**
  * Component that manages I/O actions for the actor it is attached to.
@@ -27,6 +53,41 @@ protected:
 	UPROPERTY(Instanced, EditInstanceOnly, EditFixedSize, NoClear, Category = "ActorIO")
 	TArray<TObjectPtr<UActorIOAction>> Actions;
 
+	/**
+	 * Logic graph of the actions, compiled when the level is cooked.
+	 * Cooked builds bind actions from the graph, instead of building the list of I/O events for the owning actor.
+	 */
+	UPROPERTY()
+	FActorIOLogicGraph LogicGraph;
+
+	/**
+	 * Actions of the component stored as plain data. Only used in cooked levels.
+	 * Action objects are only created from the data when they are needed. @see GetOrCreateAction, UActorIOSettings::bStructBackedActions
+	 */
+	UPROPERTY()
+	TArray<FActorIOActionData> ActionData;
+
+	/**
+	 * I/O events bound by the component on behalf of its plain data actions, indexed by dispatch slot.
+	 * Events that don't fit into the dispatch slots have their actions created and bound one by one.
+	 */
+	TArray<FActorIOEventDispatcher> EventDispatchers;
+
+	/** Whether the action list was sized to the plain data actions. */
+	bool bActionDataSlotsCreated;
+
+	/** Whether the actions were bound using the compiled logic graph. */
+	bool bBoundFromLogicGraph;
+
+	/** Whether binding the actions was deferred by the I/O subsystem, and they are not bound yet. @see BindDeferredActions */
+	bool bBindingDeferred;
+
+	/** Maximum number of I/O events that can be bound through event dispatchers. */
+	static constexpr int32 MaxEventDispatchers = 8;
+
+	/** Names of the functions that the event dispatchers bind to I/O events, indexed by dispatch slot. @see DispatchEvent0 */
+	static const FName DispatchFunctionNames[MaxEventDispatchers];
+
 public:
 
 	/** Creates a new I/O action and adds it to the action list. */
@@ -44,12 +105,45 @@ public:
 	/** Removes all invalid (nullptr) entries from the action list. */
 	void CompactActions();
 
-	/** @return List I/O actions managed by the component. */
+	/**
+	 * @return List I/O actions managed by the component.
+	 * Actions stored as plain data are only created when needed, so the list has null entries for them. @see GetOrCreateAction
+	 */
 	const TArray<TObjectPtr<UActorIOAction>>& GetActions() const { return Actions; }
 
+	/**
+	 * Get the action at the given index, creating it from plain data if it was not needed before.
+	 * Use this instead of GetActions when the action objects of a cooked level are needed, e.g. by script or debug tools.
+	 */
+	UActorIOAction* GetOrCreateAction(int32 ActionIdx);
+
+	/** @return Whether the action at the given index is stored as plain data. The action object may not exist yet. */
+	bool IsDataAction(int32 ActionIdx) const { return ActionData.IsValidIndex(ActionIdx); }
+
+	/** @return Plain data of the action at the given index, or nullptr if the action is not stored as plain data. */
+	const FActorIOActionData* GetActionData(int32 ActionIdx) const { return ActionData.IsValidIndex(ActionIdx) ? &ActionData[ActionIdx] : nullptr; }
+
 	/** @return Number of actions. */
 	int32 GetNumActions() const { return Actions.Num(); }
 
+	/** @return Logic graph of the actions. Only compiled in cooked levels. */
+	const FActorIOLogicGraph& GetLogicGraph() const { return LogicGraph; }
+
+#if WITH_EDITOR
+	/**
+	 * Compile the logic graph of the actions. Called when the level is cooked.
+	 * Actions that are stripped from the cooked level are left out of the graph.
+	 * Actions of I/O events that can't be compiled keep their argument tokens, and are bound at runtime.
+	 */
+	void CompileLogicGraph();
+
+	/**
+	 * Undo the cook time changes of the component, after its package was saved by the cooker.
+	 * Levels cooked in the editor stay loaded, and stripped actions would be treated as editor only otherwise.
+	 */
+	void PostCookSave();
+#endif
+
 public:
 
 	/**
@@ -66,21 +160,174 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ActorIO", meta = (Keywords = "Save,Load"))
 	void RestoreFromRawData(UPARAM(Ref) TArray<uint8>& RawData);
 
-protected:
+	/**
+	 * Get a hash of the action layout, made from the names of the actions in their current order.
+	 * Executed states saved as a bitset can only be restored if the layout hash is unchanged.
+	 */
+	uint32 GetActionLayoutHash() const;
+
+	/** Get the layout hash of the given action list. @see GetActionLayoutHash */
+	static uint32 GetActionLayoutHash(const TArray<TObjectPtr<UActorIOAction>>& InActions);
+
+	/** Get the executed state of every action, in the order of the action list. */
+	void GetExecutedStates(TBitArray<>& OutStates) const;
+
+	/**
+	 * Restore the executed state of every action, in the order of the action list.
+	 * The states must be from a component with the same action layout.
+	 */
+	void RestoreExecutedStates(const TBitArray<>& InStates);
+
+	/** Get the stable ids of the executed actions. */
+	void GetExecutedActionIds(TArray<FGuid>& OutIds) const;
+
+	/**
+	 * Restore the executed state of every action by its stable id.
+	 * Actions whose id is not in the list are restored as not executed. Works with any action layout.
+	 */
+	void RestoreExecutedStatesById(TConstArrayView<FGuid> InExecutedIds);
+
+public:
 
-	/** Binds all actions to their assigned I/O events. */
+	/**
+	 * Binds all actions to their assigned I/O events.
+	 * Called automatically when the component is initialized, unless binding is deferred by the I/O subsystem.
+	 */
 	void BindActions();
 
-	/** Unbinds all actions. */
+	/**
+	 * Binds all actions if binding was deferred by the I/O subsystem, and they are not bound yet.
+	 * Called by the I/O subsystem while binding over multiple frames, or by the component when the owning actor begins play, whichever is first.
+	 */
+	void BindDeferredActions();
+
+	/**
+	 * Unbinds all actions.
+	 * If the owning actor is being removed, actions bound to delegates of the actor itself are skipped.
+	 */
 	void UnbindActions();
 
+protected:
+
+	/**
+	 * @return Whether the owning actor is being destroyed, or unloaded together with its level.
+	 * Levels that are only made invisible don't count, since their actors stay alive.
+	 */
+	bool IsOwnerBeingRemoved() const;
+
+	/**
+	 * Bind actions using the compiled logic graph.
+	 * 
+	 * @return Whether all actions were bound. If not, the remaining actions should be bound the regular way.
+	 */
+	bool BindActionsFromLogicGraph();
+
+	/** Bind the given actions by building the list of I/O events of the owning actor. */
+	void BindActionsFromEventList(TConstArrayView<int32> ActionIndices);
+
+#if WITH_EDITOR
+	/**
+	 * Mark the actions that can never be executed as stripped, so that they are left out of the cooked level.
+	 * Stripped actions are reported in the cook log. @see UActorIOSettings::bStripDeadActionsOnCook
+	 *
+	 * @param bCooking Whether the level is being cooked. If false, all actions are unmarked.
+	 */
+	void StripDeadActions(bool bCooking);
+
+	/**
+	 * Store the actions that are not stripped as plain data, and leave the action objects out of the cooked level.
+	 * Called when the level is cooked, after the logic graph is compiled. @see UActorIOSettings::bStructBackedActions
+	 *
+	 * @param bCooking Whether the level is being cooked. If false, the plain data is cleared.
+	 */
+	void BuildActionData(bool bCooking);
+#endif
+
+	/**
+	 * Size the action list to the plain data of a cooked level. Action objects are created later when needed.
+	 * Stripped action objects are saved as null entries, so the action list of a cooked level only has nulls at this point.
+	 */
+	void CreateActionDataSlots();
+
+	/** Create the action object of a plain data action. */
+	UActorIOAction* CreateActionFromData(int32 ActionIdx);
+
+	/**
+	 * Create all action objects, and stop using the plain data. Actions stay bound.
+	 * Called before the action list is modified, since plain data actions are referred to by index.
+	 */
+	void ReleaseActionData();
+
+	/** Bind the given plain data actions to an I/O event, using a dispatch slot if there is one available. */
+	void BindEventDispatcher(const FActorIOEvent& InEvent, TArray<int32>&& ActionIndices);
+
+	/** Unbind the event dispatchers. Dispatchers of delegates that are destroyed together with the owning actor are skipped. */
+	void UnbindEventDispatchers(bool bOwnerIsBeingRemoved);
+
+	/** @return Index of the event dispatcher that calls the given function, or INDEX_NONE. */
+	int32 GetEventDispatcherIndex(const UFunction* Function) const;
+
+	/** @return Index of the event dispatcher that the action at the given index is bound to, or INDEX_NONE. */
+	int32 FindEventDispatcherOfAction(int32 ActionIdx) const;
+
+	/**
+	 * Execute the plain data actions bound to an event dispatcher, with the original script memory of the I/O event.
+	 * Action objects are created the first time their event fires.
+	 */
+	void DispatchEvent(int32 DispatcherIdx, void* Parms);
+
+	/**
+	 * Add an action that was created after the component was loaded to the garbage collection cluster of the component.
+	 * Objects in a cluster are not traversed by the garbage collector, so the action would not be kept alive otherwise.
+	 */
+	void AddActionToCluster(UActorIOAction* InAction);
+
+	/**
+	 * Serialize the executed actions as a map of action name to action record.
+	 * Used when the action layout has changed since the component was initialized, and by older save files.
+	 */
+	void SerializeActionsByName(FStructuredArchive::FRecord Record, int32 Version);
+
+	/**
+	 * Functions bound to I/O events by the event dispatchers, one per dispatch slot.
+	 * The call is caught in ProcessEvent, where it is dispatched to the actions. These do nothing on their own.
+	 */
+	UFUNCTION()
+	void DispatchEvent0() {}
+	UFUNCTION()
+	void DispatchEvent1() {}
+	UFUNCTION()
+	void DispatchEvent2() {}
+	UFUNCTION()
+	void DispatchEvent3() {}
+	UFUNCTION()
+	void DispatchEvent4() {}
+	UFUNCTION()
+	void DispatchEvent5() {}
+	UFUNCTION()
+	void DispatchEvent6() {}
+	UFUNCTION()
+	void DispatchEvent7() {}
+
+protected:
+
+	/**
+	 * Action layout hash of the component when it was initialized.
+	 * If actions were added or removed since then, executed states are saved by name instead.
+	 */
+	TOptional<uint32> InitialLayoutHash;
+
 public:
 
 	//~ Begin UActorComponent Interface
 	virtual void OnRegister() override;
 	virtual void InitializeComponent() override;
+	virtual void BeginPlay() override;
 	virtual void UninitializeComponent() override;
 	virtual void Serialize(FStructuredArchive::FRecord Record) override;
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+	virtual bool CanBeClusterRoot() const override;
+	virtual void ProcessEvent(UFunction* Function, void* Parms) override;
 #if WITH_EDITOR
 	virtual void CheckForErrors() override;
 #endif
@@ -0,0 +1,157 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#pragma once
+
+#include "ActorIO.h"
+#include "ActorIOLogicGraph.generated.h"
+
+class AActor;
+struct FActorIORegisteredEvent;
+
+/** Type of the delegate of a compiled I/O event. */
+UENUM()
+enum class EActorIOGraphDelegateType : uint8
+{
+	/** A blueprint exposed dynamic delegate, found by property name. */
+	BlueprintDelegate,
+	/** A sparse delegate, found by name in the sparse delegate storage. */
+	SparseDelegate,
+	/** A multicast delegate, found by the name of its multicast delegate property. */
+	MulticastDelegate
+};
+
+/** The object that the event processor of a compiled I/O event is bound to. */
+UENUM()
+enum class EActorIOGraphProcessorOwner : uint8
+{
+	/** The I/O event has no event processor. */
+	None,
+	/** The event processor is a function of the delegate owner. */
+	DelegateOwner,
+	/** The event processor is a function of the actor. */
+	Actor,
+	/** The event processor is a function of the I/O subsystem. */
+	Subsystem
+};
+
+/**
+ * An I/O event of an actor that has actions bound to it, compiled at cook time.
+ * Describes the delegate of the event by name, so that it can be resolved without building the list of I/O events for the actor.
+ */
+USTRUCT()
+struct ACTORIO_API FActorIOGraphEvent
+{
+	GENERATED_BODY()
+
+	/** Id of the I/O event. */
+	UPROPERTY()
+	FName EventId;
+
+	/** Type of the delegate. */
+	UPROPERTY()
+	EActorIOGraphDelegateType DelegateType = EActorIOGraphDelegateType::BlueprintDelegate;
+
+	/** Name of the delegate. For multicast delegates this is the name of the delegate property. */
+	UPROPERTY()
+	FName DelegateName;
+
+	/** Default subobject of the actor that owns the delegate. If none, the delegate is owned by the actor itself. */
+	UPROPERTY()
+	FName DelegateSubobject;
+
+	/** The object that the event processor is bound to. */
+	UPROPERTY()
+	EActorIOGraphProcessorOwner ProcessorOwner = EActorIOGraphProcessorOwner::None;
+
+	/** Name of the event processor function. */
+	UPROPERTY()
+	FName EventProcessor;
+
+	/** Indices of the actions bound to the event, in the order of the action list. */
+	UPROPERTY()
+	TArray<int32> ActionIndices;
+
+	/**
+	 * Build the I/O event described by this entry for the given actor.
+	 *
+	 * @return Whether the event could be built. Fails if the delegate owner no longer exists.
+	 */
+	bool MakeEvent(AActor* InActor, FActorIOEvent& OutEvent) const;
+
+#if WITH_EDITOR
+	/**
+	 * Compile the given I/O event of the actor.
+	 *
+	 * @return Whether the event could be described by names. Fails for multicast delegates that are not properties, and delegates or event processors of other objects.
+	 */
+	static bool Compile(const FActorIOEvent& InEvent, AActor* InActor, FActorIOGraphEvent& OutEvent);
+
+	/**
+	 * Compile an I/O event registered by the registration table of the I/O subsystem.
+	 * Does not need a subsystem instance, so that these events can be compiled when the level is cooked.
+	 *
+	 * @return Whether the event could be compiled.
+	 */
+	static bool CompileRegistered(const FActorIORegisteredEvent& InEvent, AActor* InActor, FActorIOGraphEvent& OutEvent);
+#endif
+};
+
+/** Compiled data of a single action. */
+USTRUCT()
+struct ACTORIO_API FActorIOGraphAction
+{
+	GENERATED_BODY()
+
+	/** The arguments of the action split into tokens, ready for named argument substitution. @see UActorIOAction::TokenizeArguments */
+	UPROPERTY()
+	TArray<FString> ArgumentTokens;
+
+	/**
+	 * Whether the action triggers a logic relay directly, instead of dispatching an I/O message.
+	 * @see UActorIOSettings::bCollapseRelayChains
+	 */
+	UPROPERTY()
+	bool bDirectRelayTrigger = false;
+};
+
+/**
+ * Flat, immutable logic graph of an I/O component, compiled when the level is cooked.
+ * Holds the event to action adjacency and pre-tokenized arguments, so that cooked builds can bind actions
+ * without building the list of I/O events of the actor, and execute them without parsing the argument strings.
+ */
+USTRUCT()
+struct ACTORIO_API FActorIOLogicGraph
+{
+	GENERATED_BODY()
+
+	/** Action layout hash of the component when the graph was compiled. The graph is ignored if the layout has changed. */
+	UPROPERTY()
+	uint32 LayoutHash = 0;
+
+	/** I/O events that have actions bound to them. */
+	UPROPERTY()
+	TArray<FActorIOGraphEvent> Events;
+
+	/** Compiled data of the actions, in the order of the action list. */
+	UPROPERTY()
+	TArray<FActorIOGraphAction> Actions;
+
+	/**
+	 * Indices of the actions whose I/O event could not be compiled (e.g. events registered by blueprint subsystems).
+	 * These are bound at runtime by building the list of I/O events of the actor.
+	 */
+	UPROPERTY()
+	TArray<int32> RuntimeBoundActions;
+
+	/** @return Whether the graph was compiled. */
+	bool IsCompiled() const { return Actions.Num() > 0; }
+
+	/** Clear the graph. */
+	void Reset()
+	{
+		LayoutHash = 0;
+		Events.Reset();
+		Actions.Reset();
+		RuntimeBoundActions.Reset();
+	}
+};
@@ -0,0 +1,276 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#pragma once
+
+#include "ActorIO.h"
+#include "Engine/DataAsset.h"
+#include "GameFramework/Actor.h"
+#include "ActorIORegistrationTable.generated.h"
+
+/** Type of delegate that a table registered I/O event is assigned to. */
+UENUM()
+enum class EActorIORegisteredDelegateType : uint8
+{
+	/** A sparse dynamic multicast delegate (e.g. OnActorBeginOverlap of actors). */
+	SparseDelegate,
+	/** A blueprint exposed dynamic multicast delegate, also known as an event dispatcher. */
+	BlueprintDelegate
+};
+
+/**
+ * An I/O event that is registered for every actor of a class, without the class having to implement the I/O interface.
+ * Used to expose functionality of classes that cannot be subclassed (e.g. engine classes) to the I/O system.
+ */
+USTRUCT(BlueprintType)
+struct ACTORIO_API FActorIORegisteredEvent
+{
+	GENERATED_BODY()
+
+	/** Actors of this class will have the event registered. */
+	UPROPERTY(EditAnywhere, Category = "Registration", meta = (AllowAbstract))
+	TSoftClassPtr<AActor> ActorClass;
+
+	/**
+	 * Whether the event is only registered for the exact class, and not for its subclasses.
+	 * Matching is done by class path, so the class does not need to be loaded for this.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Registration")
+	bool bExactClass = false;
+
+	/** Subclasses of the actor class that should not have the event registered. */
+	UPROPERTY(EditAnywhere, Category = "Registration", meta = (AllowAbstract))
+	TArray<TSoftClassPtr<AActor>> ExcludedClasses;
+
+	/** Unique id of the event. @see FActorIOEvent::EventId */
+	UPROPERTY(EditAnywhere, Category = "Event")
+	FName EventId;
+
+#if WITH_EDITORONLY_DATA
+	/** Display name to use in the editor. If empty, event id will be used. */
+	UPROPERTY(EditAnywhere, Category = "Event")
+	FText DisplayName;
+
+	/** Tooltip text to display in the editor. */
+	UPROPERTY(EditAnywhere, Category = "Event")
+	FText TooltipText;
+#endif
+
+	/** The type of the delegate to assign. */
+	UPROPERTY(EditAnywhere, Category = "Event")
+	EActorIORegisteredDelegateType DelegateType = EActorIORegisteredDelegateType::BlueprintDelegate;
+
+	/** Name of the delegate property to assign. */
+	UPROPERTY(EditAnywhere, Category = "Event")
+	FName DelegateName;
+
+	/** Default subobject of the actor that owns the delegate. If none, the delegate is owned by the actor itself. */
+	UPROPERTY(EditAnywhere, Category = "Event")
+	FName DelegateSubobject;
+
+	/**
+	 * Name of a function on the I/O subsystem to use as the event processor. Optional.
+	 * @see FActorIOEvent::EventProcessor
+	 */
+	UPROPERTY(EditAnywhere, Category = "Event")
+	FName EventProcessor;
+
+	/** Default constructor. */
+	FActorIORegisteredEvent() {}
+
+	/** Constructor for registering an event for the given class. */
+	explicit FActorIORegisteredEvent(const TSoftClassPtr<AActor>& InActorClass) :
+		ActorClass(InActorClass)
+	{}
+
+	/** Only register the event for the exact class, and not for its subclasses. */
+	FActorIORegisteredEvent& SetExactClass()
+	{
+		bExactClass = true;
+		return *this;
+	}
+
+	/** Do not register the event for the given subclass. */
+	FActorIORegisteredEvent& AddExcludedClass(const TSoftClassPtr<AActor>& InExcludedClass)
+	{
+		ExcludedClasses.Add(InExcludedClass);
+		return *this;
+	}
+
+	/** Set the id of the event. @see FActorIOEvent::SetId */
+	FActorIORegisteredEvent& SetId(FName InEventId)
+	{
+		EventId = InEventId;
+		return *this;
+	}
+
+	/** Set the display name to use in the editor. If empty, event id will be used. */
+	FActorIORegisteredEvent& SetDisplayName(const FText& InDisplayName)
+	{
+#if WITH_EDITORONLY_DATA
+		DisplayName = InDisplayName;
+#endif
+		return *this;
+	}
+
+	/** Set the tooltip text to use in the editor. */
+	FActorIORegisteredEvent& SetTooltipText(const FText& InTooltipText)
+	{
+#if WITH_EDITORONLY_DATA
+		TooltipText = InTooltipText;
+#endif
+		return *this;
+	}
+
+	/** Assign a sparse delegate of the actor, or the given default subobject. */
+	FActorIORegisteredEvent& SetSparseDelegate(FName InDelegateName, FName InDelegateSubobject = NAME_None)
+	{
+		DelegateType = EActorIORegisteredDelegateType::SparseDelegate;
+		DelegateName = InDelegateName;
+		DelegateSubobject = InDelegateSubobject;
+		return *this;
+	}
+
+	/** Assign a blueprint exposed delegate of the actor, or the given default subobject. */
+	FActorIORegisteredEvent& SetBlueprintDelegate(FName InDelegateName, FName InDelegateSubobject = NAME_None)
+	{
+		DelegateType = EActorIORegisteredDelegateType::BlueprintDelegate;
+		DelegateName = InDelegateName;
+		DelegateSubobject = InDelegateSubobject;
+		return *this;
+	}
+
+	/** Assign a function of the I/O subsystem as the event processor. */
+	FActorIORegisteredEvent& SetEventProcessor(FName InFunctionName)
+	{
+		EventProcessor = InFunctionName;
+		return *this;
+	}
+};
+
+/**
+ * An I/O function that is registered for every actor of a class, without the class having to implement the I/O interface.
+ * Used to expose functionality of classes that cannot be subclassed (e.g. engine classes) to the I/O system.
+ */
+USTRUCT(BlueprintType)
+struct ACTORIO_API FActorIORegisteredFunction
+{
+	GENERATED_BODY()
+
+	/** Actors of this class will have the function registered. */
+	UPROPERTY(EditAnywhere, Category = "Registration", meta = (AllowAbstract))
+	TSoftClassPtr<AActor> ActorClass;
+
+	/**
+	 * Whether the function is only registered for the exact class, and not for its subclasses.
+	 * Matching is done by class path, so the class does not need to be loaded for this.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Registration")
+	bool bExactClass = false;
+
+	/** Subclasses of the actor class that should not have the function registered. */
+	UPROPERTY(EditAnywhere, Category = "Registration", meta = (AllowAbstract))
+	TArray<TSoftClassPtr<AActor>> ExcludedClasses;
+
+	/** Unique id of the function. @see FActorIOFunction::FunctionId */
+	UPROPERTY(EditAnywhere, Category = "Function")
+	FName FunctionId;
+
+#if WITH_EDITORONLY_DATA
+	/** Display name to use in the editor. If empty, function id will be used. */
+	UPROPERTY(EditAnywhere, Category = "Function")
+	FText DisplayName;
+
+	/** Tooltip text to display in the editor. */
+	UPROPERTY(EditAnywhere, Category = "Function")
+	FText TooltipText;
+#endif
+
+	/** The name of the UFUNCTION to execute. */
+	UPROPERTY(EditAnywhere, Category = "Function")
+	FString FunctionToExec;
+
+	/** Default subobject of the actor to call the function on. If none, the function is called on the actor itself. */
+	UPROPERTY(EditAnywhere, Category = "Function")
+	FName TargetSubobject;
+
+	/** Default constructor. */
+	FActorIORegisteredFunction() {}
+
+	/** Constructor for registering a function for the given class. */
+	explicit FActorIORegisteredFunction(const TSoftClassPtr<AActor>& InActorClass) :
+		ActorClass(InActorClass)
+	{}
+
+	/** Only register the function for the exact class, and not for its subclasses. */
+	FActorIORegisteredFunction& SetExactClass()
+	{
+		bExactClass = true;
+		return *this;
+	}
+
+	/** Do not register the function for the given subclass. */
+	FActorIORegisteredFunction& AddExcludedClass(const TSoftClassPtr<AActor>& InExcludedClass)
+	{
+		ExcludedClasses.Add(InExcludedClass);
+		return *this;
+	}
+
+	/** Set the id of the function. @see FActorIOFunction::SetId */
+	FActorIORegisteredFunction& SetId(FName InFunctionId)
+	{
+		FunctionId = InFunctionId;
+		return *this;
+	}
+
+	/** Set the display name to use in the editor. If empty, function id will be used. */
+	FActorIORegisteredFunction& SetDisplayName(const FText& InDisplayName)
+	{
+#if WITH_EDITORONLY_DATA
+		DisplayName = InDisplayName;
+#endif
+		return *this;
+	}
+
+	/** Set the tooltip text to use in the editor. */
+	FActorIORegisteredFunction& SetTooltipText(const FText& InTooltipText)
+	{
+#if WITH_EDITORONLY_DATA
+		TooltipText = InTooltipText;
+#endif
+		return *this;
+	}
+
+	/** Set the name of the UFUNCTION to execute. */
+	FActorIORegisteredFunction& SetFunction(const FString& InFunctionName)
+	{
+		FunctionToExec = InFunctionName;
+		return *this;
+	}
+
+	/** Set the default subobject to call the function on instead of the actor itself. */
+	FActorIORegisteredFunction& SetSubobject(FName InSubobjectName)
+	{
+		TargetSubobject = InSubobjectName;
+		return *this;
+	}
+};
+
+/**
+ * Data asset with I/O events and functions registered for classes.
+ * Tables listed in the Actor I/O settings are added to the registrations of the I/O subsystem.
+ */
+UCLASS(BlueprintType, DisplayName = "Actor I/O Registration Table")
+class ACTORIO_API UActorIORegistrationTable : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** I/O events to register. */
+	UPROPERTY(EditAnywhere, Category = "Registration")
+	TArray<FActorIORegisteredEvent> Events;
+
+	/** I/O functions to register. */
+	UPROPERTY(EditAnywhere, Category = "Registration")
+	TArray<FActorIORegisteredFunction> Functions;
+};
@@ -7,6 +7,8 @@
 #include "Templates/SubclassOf.h"
 #include "ActorIOSettings.generated.h"
 
+class AActor;
+
 /** Determines how level activation is handled. */
 UENUM()
 enum class ELevelActivationMethod : uint8
@@ -55,6 +57,70 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Settings")
 	ELevelActivationMethod LevelActivationMethod;
 
+	/**
+	 * Whether actions of levels that are streamed in at runtime should be bound over multiple frames.
+	 * This spreads the cost of binding every action of a large level over the frames the level is being streamed in.
+	 * The actions of an actor are always bound by the time the actor begins play, so events fired from begin play onward execute their actions.
+	 * Levels are only activated once all of their actions are bound.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance")
+	bool bTimeSlicedBinding;
+
+	/** Maximum time in milliseconds that can be spent on binding actions in a single frame. */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (EditCondition = "bTimeSlicedBinding", ClampMin = "0.01", Units = "ms"))
+	float BindingTimeBudgetMs;
+
+	/**
+	 * Whether actions that trigger a logic relay in the same level with no delay and no arguments should call the relay directly in cooked builds.
+	 * This removes the I/O message dispatch of every hop in a relay chain, while the relay still respects being enabled or disabled.
+	 * Only takes effect in cooked builds, since it is compiled into the logic graph of the level.
+	 * Collapsed hops are delivered with UActorIOSubsystemBase::ProcessDirectRelayTrigger instead of ProcessMessage.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance")
+	bool bCollapseRelayChains;
+
+	/**
+	 * Whether actions that can never be executed are stripped from cooked levels.
+	 * This includes actions with no event, function or target actor selected, and actions targeting editor only actors.
+	 * Stripped actions are reported in the cook log. Individual actions can opt out with Keep When Cooking.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance")
+	bool bStripDeadActionsOnCook;
+
+	/**
+	 * Whether cooked levels store I/O actions as plain data, instead of as one instanced object per action.
+	 * This reduces the number of exports in cooked packages, and makes loading levels with many actions faster.
+	 * The I/O component binds a single delegate per I/O event, and dispatches the event to its actions by index.
+	 * Action objects are only created when they are needed (e.g. the action is executed, or requested by script),
+	 * with the same names and ids, so the layout hash and save data of components are the same in both modes.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance")
+	bool bStructBackedActions;
+
+	/**
+	 * Additional tables of I/O events and functions registered for classes.
+	 * Use these to expose classes that cannot implement the I/O interface, without subclassing the I/O subsystem.
+	 * Requires a level reload to fully take effect.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Registration")
+	TArray<TSoftObjectPtr<class UActorIORegistrationTable>> RegistrationTables;
+
+	/**
+	 * Registry where the I/O events and functions of blueprints are captured when they are compiled in the editor.
+	 * At runtime, blueprint registrations are read from the registry instead of executing the blueprint functions.
+	 * If none, the blueprint functions are always executed.
+	 * Make sure that the asset is cooked (e.g. it is in a directory that is always cooked).
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Registration")
+	TSoftObjectPtr<class UActorIOClassRegistry> ClassRegistry;
+
+	/**
+	 * Actor classes that always execute their blueprint registration functions at runtime, including their subclasses.
+	 * Use this for blueprints that register different I/O events or functions based on their instance properties.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Registration")
+	TArray<TSoftClassPtr<AActor>> DynamicRegistrationClasses;
+
 public:
 
 #if WITH_EDITOR
@@ -3,10 +3,89 @@
 #pragma once
 
 #include "ActorIO.h"
+#include "ActorIORegistrationTable.h"
+#include "ActorIOClassRegistry.h"
+#include "ActorIOActionRegistry.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "ActorIOSubsystemBase.generated.h"
 
 class UActorIOAction;
+class UActorIOComponent;
+class ALogicRelay;
+class APawn;
+class AController;
+
+/** Saved I/O state of a single actor. */
+struct FActorIOActorSaveData
+{
+	/** Name of the actor in its level. */
+	FName ActorName;
+
+	/** Action layout hash of the actor's I/O component. Only used if the actor has an I/O component. */
+	uint32 LayoutHash = 0;
+
+	/** Executed states of the actions, in the order of the action list. Empty if the actor has no I/O component. */
+	TBitArray<> ExecutedStates;
+
+	/** Stable ids of the executed actions. Used instead of the executed states if the action layout has changed since the save was made. */
+	TArray<FGuid> ExecutedActionIds;
+
+	/** Offset of the actor's save properties in the level's property data. */
+	int32 PropertyOffset = 0;
+
+	/** Size of the actor's save properties in the level's property data. Zero if the actor is not a logic actor. */
+	int32 PropertySize = 0;
+};
+
+/** Saved I/O state of a single level. */
+struct FActorIOLevelSaveData
+{
+	/** Path of the level, without PIE prefix. */
+	FString LevelPath;
+
+	/** Saved state of the I/O actors in the level. */
+	TArray<FActorIOActorSaveData> Actors;
+
+	/** Save properties of all logic actors in the level, in a single contiguous block. */
+	TArray<uint8> PropertyData;
+};
+
+/**
+ * Saved I/O state of a world, or some of its levels.
+ * Contains the executed states of I/O actions, the save properties of logic actors, and pending I/O messages.
+ * Captured and applied on the game thread by the I/O subsystem. Serializing the save data itself does not touch any UObjects,
+ * so it can be done on any thread.
+ */
+struct ACTORIO_API FActorIOWorldSaveData
+{
+	/** Saved state of the levels. */
+	TArray<FActorIOLevelSaveData> Levels;
+
+	/** I/O messages that were pending when the save data was captured. */
+	TArray<FActorIOMessage> PendingMessages;
+
+	/**
+	 * Serialize the save data to or from a binary archive. Thread safe.
+	 * @return False if the data was malformed when loading.
+	 */
+	bool Serialize(FArchive& Ar);
+
+	/** Encode the save data into raw data, optionally compressing it. Thread safe. */
+	void Encode(TArray<uint8>& OutRawData, bool bCompress = false);
+
+	/**
+	 * Decode the save data from raw data. Compressed data is detected automatically. Thread safe.
+	 * @return False if the data was malformed.
+	 */
+	bool Decode(const TArray<uint8>& InRawData);
+};
+
+/** Delegate for when the I/O state of the world was serialized asynchronously. */
+DECLARE_DELEGATE_OneParam(FOnActorIOWorldSerialized, TArray<uint8>& /* RawData */);
+
+/** Blueprint delegate for when the I/O state of the world was serialized asynchronously. */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnActorIOWorldSerializedDynamic, const TArray<uint8>&, RawData);
 
 /**
  * Base implementation of the Actor I/O Subsystem.
@@ -45,6 +124,100 @@ protected:
 	UPROPERTY(Transient)
 	FActionExecutionContext ActionExecContext;
 
+	/** I/O components of a level that are waiting for their actions to be bound. */
+	struct FPendingLevelBinding
+	{
+		/** The level that the components belong to. */
+		TWeakObjectPtr<ULevel> Level;
+
+		/** Components waiting for their actions to be bound, in initialization order. */
+		TArray<TWeakObjectPtr<UActorIOComponent>> Components;
+
+		/** Index of the next component to bind. */
+		int32 NextComponentIdx = 0;
+
+		/** Whether the level should be activated once all components are bound. */
+		bool bActivateWhenDone = false;
+	};
+
+	/**
+	 * List of levels whose I/O components are being bound in a time sliced manner.
+	 * Only used when time sliced binding is enabled in the Actor I/O settings.
+	 */
+	TArray<FPendingLevelBinding> PendingLevelBindings;
+
+	/**
+	 * Cache of resolved subobjects for I/O functions that are executed on a subobject of the target actor.
+	 * Keyed by the target actor and the name of the subobject. Entries are re-resolved if the cached subobject is no longer valid,
+	 * and removed if the subobject is not found anymore. Entries of removed levels are also pruned when the level is removed.
+	 */
+	TMap<TPair<TObjectKey<AActor>, FName>, TWeakObjectPtr<UObject>> SubobjectCache;
+
+	/**
+	 * Table of I/O events registered for classes.
+	 * Built once when the subsystem is initialized. @see BuildRegistrationTable
+	 */
+	TArray<FActorIORegisteredEvent> RegisteredEvents;
+
+	/**
+	 * Table of I/O functions registered for classes.
+	 * Built once when the subsystem is initialized. @see BuildRegistrationTable
+	 */
+	TArray<FActorIORegisteredFunction> RegisteredFunctions;
+
+	/** Registrations from the tables that apply to a specific class. */
+	struct FClassRegistrations
+	{
+		/** Indices of the registered events that apply to the class. */
+		TArray<int32> EventIndices;
+
+		/** The registered functions that apply to the class, ready to be added to function lists. */
+		TArray<FActorIOFunction> Functions;
+
+		/**
+		 * Blueprint registrations of the class captured in the class registry.
+		 * Unset if the class is not in the registry, or uses dynamic registration.
+		 */
+		TOptional<FActorIOClassRegistration> StaticRegistration;
+	};
+
+	/** Registrations of classes, memoized the first time they are requested for a class. */
+	TMap<TObjectKey<UClass>, FClassRegistrations> ClassRegistrationCache;
+
+	/**
+	 * Registry of blueprint I/O events and functions captured in the editor.
+	 * Only loaded in game worlds, so that the editor always reflects the current state of blueprints.
+	 */
+	UPROPERTY(Transient)
+	TObjectPtr<UActorIOClassRegistry> ClassRegistry;
+
+	/**
+	 * Global named arguments computed in the frame of CachedGlobalNamedArgumentsFrame.
+	 * Shared by every action executed in that frame. @see CVarCacheGlobalNamedArgs
+	 */
+	TMap<FString, FString> CachedGlobalNamedArguments;
+
+	/** Global object named arguments computed in the frame of CachedGlobalNamedArgumentsFrame. */
+	TMap<FString, TWeakObjectPtr<UObject>> CachedGlobalObjectArguments;
+
+	/** The frame when the cached global named arguments were computed. */
+	uint64 CachedGlobalNamedArgumentsFrame;
+
+	/** Whether the cached global named arguments are valid. */
+	bool bHasCachedGlobalNamedArguments;
+
+	/**
+	 * Objects of the typed object arguments of the I/O message that is being executed.
+	 * Only set while ExecuteCommand is called by ProcessMessage.
+	 */
+	const TArray<TWeakObjectPtr<UObject>>* CommandObjectArguments;
+
+	/**
+	 * Registry of all bound actions in the world.
+	 * Actions add themselves when bound, and remove themselves when unbound.
+	 */
+	FActorIOActionRegistry ActionRegistry;
+
 	/** Handle for when a level is added to the world. */
 	FDelegateHandle DelegateHandle_OnLevelAdded;
 
@@ -56,9 +229,18 @@ public:
 	/** Get the I/O subsystem of the given world. */
 	static UActorIOSubsystemBase* Get(UObject* WorldContextObject);
 
+#if WITH_EDITOR
+	/**
+	 * Get the I/O events that the registration table of the configured subsystem class registers for the given class.
+	 * Does not need a subsystem instance, so that logic graphs can be compiled when the level is cooked.
+	 */
+	static void GetRegisteredEventsForClass(UClass* InClass, TArray<FActorIORegisteredEvent>& OutEvents);
+#endif
+
 	/**
 	 * Opportunity to externally expose events of an actor to the I/O system.
 	 * Used to expose functionality from base Unreal Engine classes without the need to subclass them.
+	 * By default this registers the events of the registration table that apply to the actor's class.
 	 * Called in editor and at runtime, when registering I/O events.
 	 */
 	virtual void RegisterNativeEventsForObject(AActor* InObject, FActorIOEventList& EventRegistry);
@@ -66,17 +248,48 @@ public:
 	/**
 	 * Opportunity to externally expose functions of an actor to the I/O system.
 	 * Used to expose functionality from base Unreal Engine classes without the need to subclass them.
+	 * By default this registers the functions of the registration table that apply to the actor's class.
 	 * Called in editor and at runtime, when registering I/O events.
 	 */
 	virtual void RegisterNativeFunctionsForObject(AActor* InObject, FActorIOFunctionList& FunctionRegistry);
 
+	/**
+	 * Register the blueprint I/O events of the actor from the class registry, instead of executing its Register I/O Events function.
+	 * 
+	 * @return Whether the class was found in the registry. If not, the blueprint function should be called instead.
+	 */
+	bool RegisterStaticEventsForObject(AActor* InObject, FActorIOEventList& EventRegistry);
+
+	/**
+	 * Register the blueprint I/O functions of the actor from the class registry, instead of executing its Register I/O Functions function.
+	 * 
+	 * @return Whether the class was found in the registry. If not, the blueprint function should be called instead.
+	 */
+	bool RegisterStaticFunctionsForObject(AActor* InObject, FActorIOFunctionList& FunctionRegistry);
+
 	/**
 	 * Opportunity to add globally available named arguments to the current execution context.
 	 * These named arguments are available for all actors.
-	 * Called at runtime, when executing an I/O action.
+	 * Called at runtime, whenever an action that uses named arguments is executed.
+	 * If ActorIO.CacheGlobalNamedArgs is enabled, it is only called once per frame and the values are shared by every action executed in that frame.
+	 * In that case values must not depend on the action being executed. Use local named arguments for that.
 	 */
 	virtual void GetGlobalNamedArguments(FActionExecutionContext& ExecutionContext);
 
+	/**
+	 * Add the global named arguments to the current execution context.
+	 * If caching is enabled, global named arguments are only computed once per frame, unless they were invalidated. @see CVarCacheGlobalNamedArgs
+	 * Called at runtime, when executing an I/O action.
+	 */
+	void ApplyGlobalNamedArguments(FActionExecutionContext& ExecutionContext);
+
+	/**
+	 * Discard the cached global named arguments, so that they are computed again for the next executed action.
+	 * Call this if a global named argument changes mid-frame. Possession changes are handled automatically.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ActorIO")
+	void InvalidateGlobalNamedArguments();
+
 	/**
 	 * Opportunity for blueprints to externally expose events of an actor to the I/O system.
 	 * Called in editor and at runtime, when registering I/O events.
@@ -94,7 +307,8 @@ public:
 	/**
 	 * Opportunity for blueprints to add globally available named arguments to the current execution context.
 	 * These named arguments are available for all actors.
-	 * Called at runtime, before executing an I/O action.
+	 * Called at runtime, whenever an action that uses named arguments is executed.
+	 * If ActorIO.CacheGlobalNamedArgs is enabled, it is only called once per frame, so values must not depend on the action being executed.
 	 */
 	UFUNCTION(BlueprintImplementableEvent, Category = "Actor IO", DisplayName = "Get Global Named Arguments", meta = (ForceAsFunction, Keywords = "IO"))
 	void K2_GetGlobalNamedArguments();
@@ -150,6 +364,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "ActorIO")
 	FSoftObjectPath GetLevelPathFromObjectPath(const FSoftObjectPath& InObjectPath) const;
 
+	/**
+	 * Check whether the given object path points to an object inside the given level.
+	 * Unlike GetLevelPathFromObjectPath, this does not construct any new paths.
+	 */
+	static bool IsObjectPathInLevel(const FSoftObjectPath& InObjectPath, const FSoftObjectPath& InLevelPath);
+
 public:
 
 	/**
@@ -158,6 +378,16 @@ public:
 	 */
 	virtual void QueueMessage(FActorIOMessage& InMessage);
 
+	/**
+	 * Trigger a logic relay directly, on behalf of an action that is part of a collapsed relay chain.
+	 * These actions do not queue an I/O message, so ProcessMessage is not called for them.
+	 * Subclasses that customize message delivery should override this as well.
+	 * Only called when the level of the relay is active.
+	 *
+	 * @see UActorIOSettings::bCollapseRelayChains
+	 */
+	virtual void ProcessDirectRelayTrigger(const UActorIOAction* InSender, ALogicRelay* InRelay);
+
 	/**
 	 * Remove all pending messages that were sent by the given I/O action.
 	 * This is used when an I/O action's state is restored from a save file and the action needs to recall its messages.
@@ -184,9 +414,40 @@ public:
 	 */
 	virtual bool ExecuteCommand(UObject* Target, const TCHAR* Str, FOutputDevice& Ar, UObject* Executor);
 
+	/**
+	 * Find a default subobject of the given actor by name.
+	 * Results are cached, so that I/O functions executed on subobjects don't need to search the actor's subobjects for every message.
+	 */
+	UObject* FindTargetSubobject(AActor* InActor, FName InSubobjectName);
+
 	/** @return Reference to the global execution context. */
 	FActionExecutionContext& GetExecutionContext() { return ActionExecContext; }
 
+	/** @return Registry of all bound actions in the world. */
+	FActorIOActionRegistry& GetActionRegistry() { return ActionRegistry; }
+
+	/** Get the number of bound actions in the world. */
+	UFUNCTION(BlueprintPure, Category = "ActorIO")
+	int32 GetNumBoundActions() const { return ActionRegistry.Num(); }
+
+public:
+
+	/**
+	 * Determine whether binding the actions of the given I/O component should be deferred.
+	 * This is the case when time sliced binding is enabled, and the component belongs to a level that is being streamed in.
+	 */
+	bool ShouldDeferBinding(UActorIOComponent* InComponent) const;
+
+	/**
+	 * Queue an I/O component to have its actions bound over the following frames.
+	 * The actions are bound when the owning actor begins play at the latest, even if the component is not up yet.
+	 * The level of the component will not be activated until all of its queued components are bound.
+	 */
+	void QueueComponentBinding(UActorIOComponent* InComponent);
+
+	/** Immediately bind the actions of all queued I/O components of the given level. */
+	void FlushPendingBindings(ULevel* InLevel);
+
 public:
 
 	/**
@@ -203,15 +464,93 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ActorIO", meta = (Keywords = "Save,Load"))
 	void RestoreFromRawData(UPARAM(Ref) TArray<uint8>& RawData);
 
+	/**
+	 * Capture the I/O state of the world into save data. Must be called on the game thread.
+	 * This includes the executed states of all I/O components, the save properties of all logic actors, and all pending messages.
+	 *
+	 * @param InLevel Only capture the given level, and the pending messages sent from it. Captures all levels if nullptr.
+	 */
+	void CaptureSaveData(FActorIOWorldSaveData& OutSaveData, ULevel* InLevel = nullptr);
+
+	/**
+	 * Restore the I/O state of the world from previously captured save data. Must be called on the game thread.
+	 * Levels that are not in the world are skipped.
+	 * Pending messages sent from the restored levels are replaced by the saved messages, which are delivered on the next tick at the earliest.
+	 */
+	void ApplySaveData(const FActorIOWorldSaveData& InSaveData);
+
+	/**
+	 * Serialize the I/O state of the world into a single blob of raw data that can be stored in save files easily.
+	 * Unlike SerializeToRawData, this also contains the state of every I/O component and logic actor.
+	 * Use in conjunction with RestoreWorldFromRawData.
+	 *
+	 * @param InLevel Only serialize the given level, and the pending messages sent from it. Serializes all levels if nullptr.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ActorIO", meta = (Keywords = "Save,Load"))
+	void SerializeWorldToRawData(TArray<uint8>& RawData, ULevel* InLevel = nullptr);
+
+	/**
+	 * Asynchronous version of SerializeWorldToRawData, intended for frequent saves like autosaves.
+	 * Only a snapshot of the I/O state is captured on the game thread. Encoding and compression is done on a worker thread.
+	 * The completion callback is called on the game thread.
+	 *
+	 * @param InLevel Only serialize the given level, and the pending messages sent from it. Serializes all levels if nullptr.
+	 * @param bCompress Whether the raw data should be compressed.
+	 */
+	void SerializeWorldToRawDataAsync(FOnActorIOWorldSerialized OnComplete, ULevel* InLevel = nullptr, bool bCompress = false);
+
+	/**
+	 * Blueprint version of SerializeWorldToRawDataAsync.
+	 * Use in conjunction with RestoreWorldFromRawData.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ActorIO", DisplayName = "Serialize World To Raw Data Async", meta = (Keywords = "Save,Load"))
+	void K2_SerializeWorldToRawDataAsync(FOnActorIOWorldSerializedDynamic OnComplete, ULevel* InLevel = nullptr, bool bCompress = false);
+
+	/**
+	 * Restore the I/O state of the world from raw data, previously saved with SerializeWorldToRawData.
+	 * Compressed data is detected automatically.
+	 * @return False if the data was malformed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ActorIO", meta = (Keywords = "Save,Load"))
+	bool RestoreWorldFromRawData(const TArray<uint8>& RawData);
+
 protected:
 
+	/**
+	 * Build the table of I/O events and functions registered for classes.
+	 * Adds the built-in registrations for engine classes, and the registration tables from the Actor I/O settings.
+	 * Override to add registrations of your own. Called once when the subsystem is initialized.
+	 */
+	virtual void BuildRegistrationTable(TArray<FActorIORegisteredEvent>& EventTable, TArray<FActorIORegisteredFunction>& FunctionTable);
+
+	/**
+	 * Get the registrations from the tables that apply to the given class.
+	 * The class hierarchy is only walked the first time a class is requested, after that the result is memoized.
+	 */
+	const FClassRegistrations& GetRegistrationsForClass(UClass* InClass);
+
+	/**
+	 * Whether a table registration applies to a class.
+	 * @param ClassHierarchy Paths of the class and all of its super classes, starting with the class itself.
+	 */
+	static bool IsRegistrationMatchingClass(TConstArrayView<FTopLevelAssetPath> ClassHierarchy, const TSoftClassPtr<AActor>& InActorClass, bool bExactClass, const TArray<TSoftClassPtr<AActor>>& InExcludedClasses);
+
+	/** Bind actions of queued I/O components until the time budget runs out, activating levels that are done. */
+	void TickPendingBindings();
+
+	/** Bind the actions of the remaining components in the given pending level binding. */
+	void BindRemainingComponents(FPendingLevelBinding& InBinding, double EndTime = 0.0);
+
 	/** Update remaining time on all pending messages, potentially activating them. */
 	void TickPendingMessages(float DeltaTime);
 	
 	/** Determine if the message can be ticked. Not const because we want to update inner properties. */
 	bool PreTickMessage(FActorIOMessage& InMessage, bool bInitialTick = false);
 
-	/** Handles the delivery of an I/O message. */
+	/**
+	 * Handles the delivery of an I/O message.
+	 * Not called for the hops of collapsed relay chains. @see ProcessDirectRelayTrigger
+	 */
 	virtual void ProcessMessage(const FActorIOMessage& InMessage);
 
 	/** Callback for when a level is added to the world. */
@@ -230,6 +569,10 @@ private:
 	UFUNCTION()
 	void ProcessEvent_OnActorDestroyed(AActor* Actor, EEndPlayReason::Type EndPlayReason);
 
+	/** Callback for when a pawn is possessed or unpossessed. Discards the cached global named arguments, since $Player may have changed. */
+	UFUNCTION()
+	void OnPawnControllerChanged(APawn* Pawn, AController* Controller);
+
 public:
 
 	//~ Begin UTickableWorldSubsystem Interface
@@ -14,6 +14,15 @@ struct FActorIOActionVersion
 		// Before any version changes were made.
 		InitialVersion = 0,
 
+		// Executed states of actions are saved as a bitset, keyed by the index of the action.
+		CompactExecutedState,
+
+		// Actions saved by name also save their stable id, which is used to find the action when loading.
+		ActionIds,
+
+		// Compact executed states also save the stable ids of executed actions, which are used if the action layout has changed.
+		CompactExecutedActionIds,
+
 		// -----<new versions can be added above this line>-------------------------------------------------
 		VersionPlusOne,
 		LatestVersion = VersionPlusOne - 1
@@ -36,6 +45,15 @@ struct FActorIOSubsystemVersion
 		// Before any version changes were made.
 		InitialVersion = 0,
 
+		// Pending messages are saved in a compact binary blob with a deduplicated string table.
+		CompactMessageFormat,
+
+		// Pending messages refer to their sender by the stable id of the action.
+		MessageSenderIds,
+
+		// Saved actors also save the stable ids of their executed actions, which are used if the action layout has changed.
+		ExecutedActionIds,
+
 		// -----<new versions can be added above this line>-------------------------------------------------
 		VersionPlusOne,
 		LatestVersion = VersionPlusOne - 1
@@ -30,6 +30,7 @@ public class ActorIOEditor : ModuleRules
             "PlacementMode",
             "WorkspaceMenuStructure",
             "ToolWidgets",
+            "Json",
         });
     }
 }
\ No newline at end of file
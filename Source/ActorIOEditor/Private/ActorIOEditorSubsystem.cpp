@@ -4,10 +4,16 @@
 #include "ActorIOEditor.h"
 #include "ActorIOComponent.h"
 #include "ActorIOAction.h"
+#include "ActorIOSettings.h"
+#include "ActorIOClassRegistry.h"
+#include "Engine/Blueprint.h"
 #include "GameFramework/Actor.h"
 #include "Selection.h"
 #include "Editor.h"
 #include "Misc/EngineVersionComparison.h"
+#include "UObject/Package.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/UObjectHash.h"
 
 UActorIOEditorSubsystem* UActorIOEditorSubsystem::Get()
 {
@@ -25,7 +31,10 @@ void UActorIOEditorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	DelegateHandle_ActorReplaced = FEditorDelegates::OnEditorActorReplaced.AddUObject(this, &ThisClass::OnActorReplaced);
 #endif
 
+	DelegateHandle_BlueprintPreCompile = GEditor->OnBlueprintPreCompile().AddUObject(this, &ThisClass::OnBlueprintPreCompile);
 	DelegateHandle_BlueprintCompiled = GEditor->OnBlueprintCompiled().AddUObject(this, &ThisClass::OnBlueprintCompiled);
+
+	DelegateHandle_PackageSaved = UPackage::PackageSavedWithContextEvent.AddUObject(this, &ThisClass::OnPackageSaved);
 }
 
 void UActorIOEditorSubsystem::Deinitialize()
@@ -37,7 +46,10 @@ void UActorIOEditorSubsystem::Deinitialize()
 	FEditorDelegates::OnEditorActorReplaced.Remove(DelegateHandle_ActorReplaced);
 #endif
 
+	GEditor->OnBlueprintPreCompile().Remove(DelegateHandle_BlueprintPreCompile);
 	GEditor->OnBlueprintCompiled().Remove(DelegateHandle_BlueprintCompiled);
+
+	UPackage::PackageSavedWithContextEvent.Remove(DelegateHandle_PackageSaved);
 }
 
 AActor* UActorIOEditorSubsystem::GetSelectedActor() const
@@ -119,11 +131,70 @@ void UActorIOEditorSubsystem::OnActorReplaced(AActor* OldActor, AActor* NewActor
 	}
 }
 
+void UActorIOEditorSubsystem::OnBlueprintPreCompile(UBlueprint* Blueprint)
+{
+	if (Blueprint)
+	{
+		CompilingBlueprints.AddUnique(Blueprint);
+	}
+}
+
 void UActorIOEditorSubsystem::OnBlueprintCompiled()
 {
+	CaptureCompiledBlueprints();
+
 	// A blueprint was recompiled, so the user may have exposed new I/O events or functions.
 	// To make the changes appear immediately, we need to update the editor window.
 	// This also handles the case where no I/O stuff was being exposed due to an error in the blueprint which may have got fixed with this recompile.
 	FActorIOEditor& ActorIOEditor = FActorIOEditor::Get();
 	ActorIOEditor.RefreshEditorWidget();
 }
+
+void UActorIOEditorSubsystem::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	// Components are only modified while their level is being cooked. @see UActorIOComponent::PreSave
+	if (!Package || !ObjectSaveContext.IsCooking())
+	{
+		return;
+	}
+
+	ForEachObjectWithPackage(Package, [](UObject* Object)
+	{
+		if (UActorIOComponent* IOComponent = Cast<UActorIOComponent>(Object))
+		{
+			IOComponent->PostCookSave();
+		}
+
+		return true;
+	});
+}
+
+void UActorIOEditorSubsystem::CaptureCompiledBlueprints()
+{
+	const TArray<TWeakObjectPtr<UBlueprint>> CompiledBlueprints = MoveTemp(CompilingBlueprints);
+	CompilingBlueprints.Reset();
+
+	const UActorIOSettings* IOSettings = UActorIOSettings::Get();
+	UActorIOClassRegistry* ClassRegistry = IOSettings->ClassRegistry.LoadSynchronous();
+	if (!ClassRegistry)
+	{
+		return;
+	}
+
+	// Capture the registrations now, so that cooked builds do not need to execute the blueprint functions.
+	// Blueprints that failed to compile are skipped, they keep their last captured registrations.
+	bool bRegistryModified = false;
+	for (const TWeakObjectPtr<UBlueprint>& BlueprintPtr : CompiledBlueprints)
+	{
+		UBlueprint* Blueprint = BlueprintPtr.Get();
+		if (Blueprint && Blueprint->GeneratedClass && Blueprint->Status != BS_Error)
+		{
+			bRegistryModified |= ClassRegistry->CaptureClass(Blueprint->GeneratedClass);
+		}
+	}
+
+	if (bRegistryModified)
+	{
+		ClassRegistry->MarkPackageDirty();
+	}
+}
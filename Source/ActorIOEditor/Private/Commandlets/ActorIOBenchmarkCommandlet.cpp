@@ -0,0 +1,756 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "Commandlets/ActorIOBenchmarkCommandlet.h"
+#include "ActorIO.h"
+#include "ActorIOComponent.h"
+#include "ActorIOAction.h"
+#include "ActorIOSubsystemBase.h"
+#include "ActorIOArgumentImporter.h"
+#include "LogicActors/LogicCounter.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UObjectGlobals.h"
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogActorIOBenchmark, Log, All);
+
+namespace ActorIOBenchmark
+{
+	/**
+	 * Allocator proxy that counts heap allocations while it is installed as GMalloc.
+	 * Every call is forwarded to the original allocator, so memory allocated before the proxy was
+	 * installed can be freed safely through the proxy and vice versa.
+	 */
+	class FCountingMalloc : public FMalloc
+	{
+	public:
+
+		FCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+			, NumAllocations(0)
+		{}
+
+		/** The allocator that every call is forwarded to. */
+		FMalloc* InnerMalloc;
+
+		/** Number of allocations made through the proxy. Counts allocations from all threads. */
+		std::atomic<int64> NumAllocations;
+
+	public:
+
+		//~ Begin FMalloc Interface
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			++NumAllocations;
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			++NumAllocations;
+			return InnerMalloc->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (!Original)
+			{
+				++NumAllocations;
+			}
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (!Original)
+			{
+				++NumAllocations;
+			}
+			return InnerMalloc->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("ActorIOBenchmarkCountingMalloc"); }
+		//~ End FMalloc Interface
+	};
+
+	/**
+	 * Scoped measurement of a benchmark stage.
+	 * Installs the counting allocator and starts the timer on construction, and writes the results into the stage on destruction.
+	 */
+	struct FScopedStageMeasurement
+	{
+		FScopedStageMeasurement(double& InOutSeconds, int64& InOutNumAllocations)
+			: OutSeconds(InOutSeconds)
+			, OutNumAllocations(InOutNumAllocations)
+			, CountingMalloc(GMalloc)
+		{
+			GMalloc = &CountingMalloc;
+			StartTime = FPlatformTime::Seconds();
+		}
+
+		~FScopedStageMeasurement()
+		{
+			const double EndTime = FPlatformTime::Seconds();
+			GMalloc = CountingMalloc.InnerMalloc;
+
+			OutSeconds += EndTime - StartTime;
+			OutNumAllocations += CountingMalloc.NumAllocations.load();
+		}
+
+		double& OutSeconds;
+		int64& OutNumAllocations;
+		FCountingMalloc CountingMalloc;
+		double StartTime;
+	};
+
+	/** Id of the I/O event that is fired on the source actors every frame. */
+	static const FName FiredEventId = TEXT("ALogicCounter::OnValueChanged");
+
+	/** Id of the I/O event that the remaining actions are bound to. This event is never fired during the benchmark. */
+	static const FName IdleEventId = TEXT("ALogicCounter::OnGetValue");
+
+	/** Id of the I/O function that the actions call on the sink actors. */
+	static const FName TargetFunctionId = TEXT("ALogicCounter::Add");
+}
+
+UActorIOBenchmarkCommandlet::UActorIOBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+
+	BenchmarkWorld = nullptr;
+	SourceActors = TArray<TObjectPtr<ALogicCounter>>();
+	SinkActors = TArray<TObjectPtr<ALogicCounter>>();
+}
+
+const TArray<UActorIOBenchmarkCommandlet::FBenchmarkVariant>& UActorIOBenchmarkCommandlet::GetBenchmarkVariants()
+{
+	// Variants are compared by running the exact same synthetic world with different console variable overrides.
+	// When a fast path is added to the I/O system behind a console variable, add a variant here that enables it.
+	static const TArray<FBenchmarkVariant> Variants =
+	{
+		{ TEXT("Default"), {} },
+		{ TEXT("Clusters"), { TEXT("ActorIO.ClusterComponents=1") } },
+		{ TEXT("GlobalArgsCache"), { TEXT("ActorIO.CacheGlobalNamedArgs=1") } },
+		{ TEXT("NoTypedObjectArgs"), { TEXT("ActorIO.TypedObjectArgs=0") } },
+		{ TEXT("NoFastArgumentImport"), { TEXT("ActorIO.FastArgumentImport=0") } },
+	};
+
+	return Variants;
+}
+
+UActorIOBenchmarkCommandlet::FBenchmarkSettings UActorIOBenchmarkCommandlet::ParseSettings(const FString& Params)
+{
+	FBenchmarkSettings Settings;
+	const TCHAR* Str = *Params;
+
+	FParse::Value(Str, TEXT("Actors="), Settings.NumActors);
+	FParse::Value(Str, TEXT("Actions="), Settings.NumActionsPerActor);
+	FParse::Value(Str, TEXT("FanOut="), Settings.FanOut);
+	FParse::Value(Str, TEXT("Frames="), Settings.NumFrames);
+	FParse::Value(Str, TEXT("DeltaTime="), Settings.DeltaTime);
+	FParse::Value(Str, TEXT("DelayedShare="), Settings.DelayedShare);
+	FParse::Value(Str, TEXT("MaxDelay="), Settings.MaxDelay);
+	FParse::Value(Str, TEXT("NamedArgShare="), Settings.NamedArgShare);
+	FParse::Value(Str, TEXT("Seed="), Settings.Seed);
+
+	Settings.NumActors = FMath::Max(Settings.NumActors, 1);
+	Settings.NumActionsPerActor = FMath::Max(Settings.NumActionsPerActor, 0);
+	Settings.FanOut = FMath::Clamp(Settings.FanOut, 0, Settings.NumActionsPerActor);
+	Settings.NumSinks = FMath::Max(Settings.NumActors / 4, 1);
+	FParse::Value(Str, TEXT("Sinks="), Settings.NumSinks);
+	Settings.NumSinks = FMath::Max(Settings.NumSinks, 1);
+	Settings.NumFrames = FMath::Max(Settings.NumFrames, 1);
+	Settings.DelayedShare = FMath::Clamp(Settings.DelayedShare, 0.0f, 1.0f);
+	Settings.MaxDelay = FMath::Max(Settings.MaxDelay, 0.0f);
+	Settings.NamedArgShare = FMath::Clamp(Settings.NamedArgShare, 0.0f, 1.0f);
+
+	return Settings;
+}
+
+int32 UActorIOBenchmarkCommandlet::Main(const FString& Params)
+{
+	const FBenchmarkSettings Settings = ParseSettings(Params);
+
+	FString VariantsParam = TEXT("Default");
+	FParse::Value(*Params, TEXT("Variants="), VariantsParam, false);
+
+	TArray<FString> VariantNames;
+	VariantsParam.ParseIntoArray(VariantNames, TEXT(","));
+
+	TSharedRef<FJsonObject> ReportJson = MakeShared<FJsonObject>();
+
+	TSharedRef<FJsonObject> SettingsJson = MakeShared<FJsonObject>();
+	SettingsJson->SetNumberField(TEXT("actors"), Settings.NumActors);
+	SettingsJson->SetNumberField(TEXT("actionsPerActor"), Settings.NumActionsPerActor);
+	SettingsJson->SetNumberField(TEXT("fanOut"), Settings.FanOut);
+	SettingsJson->SetNumberField(TEXT("sinks"), Settings.NumSinks);
+	SettingsJson->SetNumberField(TEXT("frames"), Settings.NumFrames);
+	SettingsJson->SetNumberField(TEXT("deltaTime"), Settings.DeltaTime);
+	SettingsJson->SetNumberField(TEXT("delayedShare"), Settings.DelayedShare);
+	SettingsJson->SetNumberField(TEXT("maxDelay"), Settings.MaxDelay);
+	SettingsJson->SetNumberField(TEXT("namedArgShare"), Settings.NamedArgShare);
+	SettingsJson->SetNumberField(TEXT("seed"), Settings.Seed);
+	ReportJson->SetObjectField(TEXT("settings"), SettingsJson);
+
+	TArray<TSharedPtr<FJsonValue>> VariantResults;
+	for (const FString& VariantName : VariantNames)
+	{
+		const FBenchmarkVariant* Variant = GetBenchmarkVariants().FindByPredicate([&VariantName](const FBenchmarkVariant& Element)
+		{
+			return VariantName.Equals(Element.Name, ESearchCase::IgnoreCase);
+		});
+
+		if (!Variant)
+		{
+			UE_LOG(LogActorIOBenchmark, Error, TEXT("Unknown benchmark variant '%s'."), *VariantName);
+			return 1;
+		}
+
+		UE_LOG(LogActorIOBenchmark, Display, TEXT("Running benchmark variant '%s'..."), Variant->Name);
+		VariantResults.Add(MakeShared<FJsonValueObject>(RunVariant(Settings, *Variant)));
+	}
+
+	ReportJson->SetArrayField(TEXT("variants"), VariantResults);
+
+	bool bScalingWithinTolerance = true;
+	if (FParse::Param(*Params, TEXT("ScalingSweep")))
+	{
+		FString CountsParam = TEXT("1000,10000,100000");
+		FParse::Value(*Params, TEXT("ScalingCounts="), CountsParam, false);
+
+		TArray<FString> CountStrings;
+		CountsParam.ParseIntoArray(CountStrings, TEXT(","));
+
+		TArray<int32> PendingCounts;
+		for (const FString& CountString : CountStrings)
+		{
+			PendingCounts.Add(FMath::Max(FCString::Atoi(*CountString), 1));
+		}
+
+		float ScalingTolerance = 3.0f;
+		FParse::Value(*Params, TEXT("ScalingTolerance="), ScalingTolerance);
+
+		UE_LOG(LogActorIOBenchmark, Display, TEXT("Running pending message scaling sweep..."));
+
+		TSharedPtr<FJsonObject> ScalingJson;
+		bScalingWithinTolerance = RunScalingSweep(Settings, PendingCounts, ScalingTolerance, ScalingJson);
+		ReportJson->SetObjectField(TEXT("scaling"), ScalingJson);
+	}
+
+	bool bImportersMatch = true;
+	if (FParse::Param(*Params, TEXT("ImportBenchmark")))
+	{
+		int32 NumIterations = 100000;
+		FParse::Value(*Params, TEXT("ImportIterations="), NumIterations);
+		NumIterations = FMath::Max(NumIterations, 1);
+
+		UE_LOG(LogActorIOBenchmark, Display, TEXT("Running argument import benchmark..."));
+
+		TSharedPtr<FJsonObject> ImportJson;
+		bImportersMatch = RunImportBenchmark(NumIterations, ImportJson);
+		ReportJson->SetObjectField(TEXT("import"), ImportJson);
+	}
+
+	FString ReportString;
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&ReportString);
+	FJsonSerializer::Serialize(ReportJson, JsonWriter);
+
+	FString OutputPath;
+	if (FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		if (!FFileHelper::SaveStringToFile(ReportString, *OutputPath))
+		{
+			UE_LOG(LogActorIOBenchmark, Error, TEXT("Failed to write benchmark report to '%s'."), *OutputPath);
+			return 1;
+		}
+
+		UE_LOG(LogActorIOBenchmark, Display, TEXT("Benchmark report written to '%s'."), *FPaths::ConvertRelativePathToFull(OutputPath));
+	}
+	else
+	{
+		UE_LOG(LogActorIOBenchmark, Display, TEXT("%s"), *ReportString);
+	}
+
+	if (!bScalingWithinTolerance)
+	{
+		UE_LOG(LogActorIOBenchmark, Error, TEXT("Per-message cost of pending messages did not stay within the given scaling tolerance."));
+		return 1;
+	}
+
+	if (!bImportersMatch)
+	{
+		UE_LOG(LogActorIOBenchmark, Error, TEXT("Specialized argument importers produced different values than the generic importer."));
+		return 1;
+	}
+
+	return 0;
+}
+
+TSharedPtr<FJsonObject> UActorIOBenchmarkCommandlet::RunVariant(const FBenchmarkSettings& Settings, const FBenchmarkVariant& Variant)
+{
+	// Apply the console variable overrides of the variant.
+	// Action execution messages are always disabled since logging would dominate the results.
+	TArray<TPair<IConsoleVariable*, FString>> PreviousValues;
+	auto ApplyConsoleVariable = [&PreviousValues](const FString& NameAndValue)
+	{
+		FString Name;
+		FString Value;
+		if (!NameAndValue.Split(TEXT("="), &Name, &Value))
+		{
+			UE_LOG(LogActorIOBenchmark, Warning, TEXT("Invalid console variable override '%s'."), *NameAndValue);
+			return;
+		}
+
+		IConsoleVariable* ConsoleVariable = IConsoleManager::Get().FindConsoleVariable(*Name);
+		if (!ConsoleVariable)
+		{
+			UE_LOG(LogActorIOBenchmark, Warning, TEXT("Console variable '%s' not found."), *Name);
+			return;
+		}
+
+		PreviousValues.Emplace(ConsoleVariable, ConsoleVariable->GetString());
+		ConsoleVariable->Set(*Value, ECVF_SetByCode);
+	};
+
+	ApplyConsoleVariable(TEXT("ActorIO.DebugActions=0"));
+	for (const TCHAR* ConsoleVariable : Variant.ConsoleVariables)
+	{
+		ApplyConsoleVariable(ConsoleVariable);
+	}
+
+	FBenchmarkStage BindStage;
+	FBenchmarkStage FireStage;
+	FBenchmarkStage TickStage;
+	FBenchmarkStage CollectStage;
+	FBenchmarkStage SerializeStage;
+	FBenchmarkStage RestoreStage;
+	FBenchmarkStage UnbindStage;
+
+	// Each variant runs in a fresh world so that results are not affected by previous runs.
+	CreateBenchmarkWorld(Settings, BindStage);
+
+	UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(BenchmarkWorld);
+	check(IOSubsystem);
+
+	int64 PeakPendingMessages = 0;
+	int64 PeakPendingMemory = 0;
+	auto SamplePendingMessages = [&]()
+	{
+		PeakPendingMessages = FMath::Max<int64>(PeakPendingMessages, IOSubsystem->GetNumPendingMessages());
+		PeakPendingMemory = FMath::Max(PeakPendingMemory, GetPendingMessagesMemory());
+	};
+
+	for (int32 FrameIdx = 0; FrameIdx != Settings.NumFrames; ++FrameIdx)
+	{
+		{
+			ActorIOBenchmark::FScopedStageMeasurement Measurement(FireStage.Seconds, FireStage.NumAllocations);
+			for (ALogicCounter* SourceActor : SourceActors)
+			{
+				SourceActor->Add(1);
+			}
+		}
+
+		FireStage.NumOps += SourceActors.Num();
+		SamplePendingMessages();
+
+		{
+			ActorIOBenchmark::FScopedStageMeasurement Measurement(TickStage.Seconds, TickStage.NumAllocations);
+			if (IOSubsystem->IsTickable())
+			{
+				IOSubsystem->Tick(Settings.DeltaTime);
+			}
+		}
+
+		TickStage.NumOps++;
+		GFrameCounter++;
+	}
+
+	// Every fired event executes the actions bound to it, and each executed action sends exactly one message.
+	const int64 NumMessagesSent = static_cast<int64>(Settings.NumFrames) * Settings.NumActors * Settings.FanOut;
+	const int64 NumMessagesDelivered = NumMessagesSent - IOSubsystem->GetNumPendingMessages();
+
+	// Measure a full garbage collection pass while the I/O components and their actions are alive.
+	{
+		ActorIOBenchmark::FScopedStageMeasurement Measurement(CollectStage.Seconds, CollectStage.NumAllocations);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	CollectStage.NumOps = static_cast<int64>(Settings.NumActors) * Settings.NumActionsPerActor;
+
+	// Save and restore the pending messages that are still in the queue.
+	TArray<uint8> SaveData;
+	{
+		ActorIOBenchmark::FScopedStageMeasurement Measurement(SerializeStage.Seconds, SerializeStage.NumAllocations);
+		IOSubsystem->SerializeToRawData(SaveData);
+	}
+
+	SerializeStage.NumOps = IOSubsystem->GetNumPendingMessages();
+
+	{
+		ActorIOBenchmark::FScopedStageMeasurement Measurement(RestoreStage.Seconds, RestoreStage.NumAllocations);
+		IOSubsystem->RestoreFromRawData(SaveData);
+	}
+
+	RestoreStage.NumOps = SerializeStage.NumOps;
+
+	DestroyBenchmarkWorld(UnbindStage);
+
+	// Restore console variables in reverse order, so that variables overridden multiple times get their original value.
+	for (int32 Idx = PreviousValues.Num() - 1; Idx >= 0; --Idx)
+	{
+		PreviousValues[Idx].Key->Set(*PreviousValues[Idx].Value, ECVF_SetByCode);
+	}
+
+	const double DispatchSeconds = FireStage.Seconds + TickStage.Seconds;
+
+	TSharedPtr<FJsonObject> VariantJson = MakeShared<FJsonObject>();
+	VariantJson->SetStringField(TEXT("name"), Variant.Name);
+	VariantJson->SetNumberField(TEXT("messagesSent"), NumMessagesSent);
+	VariantJson->SetNumberField(TEXT("messagesDelivered"), NumMessagesDelivered);
+	VariantJson->SetNumberField(TEXT("messagesPerSecond"), DispatchSeconds > 0.0 ? NumMessagesSent / DispatchSeconds : 0.0);
+	VariantJson->SetNumberField(TEXT("allocationsPerMessage"), NumMessagesSent > 0 ? static_cast<double>(FireStage.NumAllocations + TickStage.NumAllocations) / NumMessagesSent : 0.0);
+	VariantJson->SetNumberField(TEXT("peakPendingMessages"), PeakPendingMessages);
+	VariantJson->SetNumberField(TEXT("peakPendingMemoryBytes"), PeakPendingMemory);
+	VariantJson->SetNumberField(TEXT("saveDataBytes"), SaveData.Num());
+
+	TSharedRef<FJsonObject> StagesJson = MakeShared<FJsonObject>();
+	StagesJson->SetObjectField(TEXT("bind"), MakeStageJson(BindStage));
+	StagesJson->SetObjectField(TEXT("fire"), MakeStageJson(FireStage));
+	StagesJson->SetObjectField(TEXT("tick"), MakeStageJson(TickStage));
+	StagesJson->SetObjectField(TEXT("gc"), MakeStageJson(CollectStage));
+	StagesJson->SetObjectField(TEXT("serialize"), MakeStageJson(SerializeStage));
+	StagesJson->SetObjectField(TEXT("restore"), MakeStageJson(RestoreStage));
+	StagesJson->SetObjectField(TEXT("unbind"), MakeStageJson(UnbindStage));
+	VariantJson->SetObjectField(TEXT("stages"), StagesJson);
+
+	return VariantJson;
+}
+
+bool UActorIOBenchmarkCommandlet::RunScalingSweep(const FBenchmarkSettings& Settings, const TArray<int32>& PendingCounts, float Tolerance, TSharedPtr<FJsonObject>& OutJson)
+{
+	// Only a single sender action and a single target is needed. Messages are queued directly on the subsystem.
+	FBenchmarkSettings SweepSettings = Settings;
+	SweepSettings.NumActors = 1;
+	SweepSettings.NumActionsPerActor = 1;
+	SweepSettings.FanOut = 0;
+	SweepSettings.NumSinks = 1;
+
+	TArray<TSharedPtr<FJsonValue>> ResultsJson;
+	double MinCountTickNs = 0.0;
+	double MaxCountTickNs = 0.0;
+	double MinCountRemoveNs = 0.0;
+	double MaxCountRemoveNs = 0.0;
+	int32 MinCount = MAX_int32;
+	int32 MaxCount = 0;
+
+	for (const int32 PendingCount : PendingCounts)
+	{
+		FBenchmarkStage DummyStage;
+		CreateBenchmarkWorld(SweepSettings, DummyStage);
+
+		UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(BenchmarkWorld);
+		UActorIOComponent* IOComponent = SourceActors[0]->FindComponentByClass<UActorIOComponent>();
+		UActorIOAction* SenderAction = IOComponent->GetActions()[0];
+
+		FActorIOMessage MessageTemplate = FActorIOMessage();
+		MessageTemplate.TargetPtr = SinkActors[0].Get();
+		MessageTemplate.FunctionId = ActorIOBenchmark::TargetFunctionId;
+		MessageTemplate.Arguments = TEXT(" 1");
+
+		// Every tenth message is due in the next tick and is sent by the sender action.
+		// The rest of the messages are never delivered, and are only ticked.
+		for (int32 MessageIdx = 0; MessageIdx != PendingCount; ++MessageIdx)
+		{
+			const bool bIsDue = MessageIdx % 10 == 0;
+
+			FActorIOMessage Message = MessageTemplate;
+			Message.SenderPtr = bIsDue ? SenderAction : nullptr;
+			Message.TimeRemaining = bIsDue ? Settings.DeltaTime * 0.5f : TNumericLimits<float>::Max();
+			IOSubsystem->QueueMessage(Message);
+		}
+
+		FBenchmarkStage TickStage;
+		{
+			ActorIOBenchmark::FScopedStageMeasurement Measurement(TickStage.Seconds, TickStage.NumAllocations);
+			IOSubsystem->Tick(Settings.DeltaTime);
+		}
+
+		TickStage.NumOps = PendingCount;
+
+		// Re-add the delivered messages, but this time with a delay so that they can be recalled.
+		for (int32 MessageIdx = 0; MessageIdx < PendingCount; MessageIdx += 10)
+		{
+			FActorIOMessage Message = MessageTemplate;
+			Message.SenderPtr = SenderAction;
+			Message.TimeRemaining = TNumericLimits<float>::Max();
+			IOSubsystem->QueueMessage(Message);
+		}
+
+		FBenchmarkStage RemoveStage;
+		RemoveStage.NumOps = IOSubsystem->GetNumPendingMessages();
+		{
+			ActorIOBenchmark::FScopedStageMeasurement Measurement(RemoveStage.Seconds, RemoveStage.NumAllocations);
+			IOSubsystem->RemovePendingMessages(SenderAction);
+		}
+
+		FBenchmarkStage UnusedStage;
+		DestroyBenchmarkWorld(UnusedStage);
+
+		const double TickNs = TickStage.Seconds * 1e9 / FMath::Max<int64>(TickStage.NumOps, 1);
+		const double RemoveNs = RemoveStage.Seconds * 1e9 / FMath::Max<int64>(RemoveStage.NumOps, 1);
+
+		if (PendingCount < MinCount)
+		{
+			MinCount = PendingCount;
+			MinCountTickNs = TickNs;
+			MinCountRemoveNs = RemoveNs;
+		}
+
+		if (PendingCount > MaxCount)
+		{
+			MaxCount = PendingCount;
+			MaxCountTickNs = TickNs;
+			MaxCountRemoveNs = RemoveNs;
+		}
+
+		TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+		ResultJson->SetNumberField(TEXT("pendingMessages"), PendingCount);
+		ResultJson->SetObjectField(TEXT("tick"), MakeStageJson(TickStage));
+		ResultJson->SetObjectField(TEXT("remove"), MakeStageJson(RemoveStage));
+		ResultsJson.Add(MakeShared<FJsonValueObject>(ResultJson));
+	}
+
+	// The ratio of per-message cost between the largest and the smallest queue. Should stay close to 1 if the cost is linear.
+	const double TickRatio = MinCountTickNs > 0.0 ? MaxCountTickNs / MinCountTickNs : 0.0;
+	const double RemoveRatio = MinCountRemoveNs > 0.0 ? MaxCountRemoveNs / MinCountRemoveNs : 0.0;
+
+	OutJson = MakeShared<FJsonObject>();
+	OutJson->SetArrayField(TEXT("results"), ResultsJson);
+	OutJson->SetNumberField(TEXT("tickCostRatio"), TickRatio);
+	OutJson->SetNumberField(TEXT("removeCostRatio"), RemoveRatio);
+	OutJson->SetNumberField(TEXT("tolerance"), Tolerance);
+
+	if (Tolerance > 0.0f)
+	{
+		return TickRatio <= Tolerance && RemoveRatio <= Tolerance;
+	}
+
+	return true;
+}
+
+bool UActorIOBenchmarkCommandlet::RunImportBenchmark(int32 NumIterations, TSharedPtr<FJsonObject>& OutJson)
+{
+	// One argument per parameter type, in the form that actions usually pass them.
+	// Edge cases of the specialized importers are covered by the ActorIO.ArgumentImporter automation specs.
+	const FString ObjectPath = GetPathName();
+	const TPair<FName, FString> Cases[] =
+	{
+		{ GET_MEMBER_NAME_CHECKED(FActorIOImportBenchmarkParams, BoolParam), TEXT("true") },
+		{ GET_MEMBER_NAME_CHECKED(FActorIOImportBenchmarkParams, IntParam), TEXT("-42") },
+		{ GET_MEMBER_NAME_CHECKED(FActorIOImportBenchmarkParams, FloatParam), TEXT("1.5") },
+		{ GET_MEMBER_NAME_CHECKED(FActorIOImportBenchmarkParams, DoubleParam), TEXT("0.25") },
+		{ GET_MEMBER_NAME_CHECKED(FActorIOImportBenchmarkParams, NameParam), TEXT("Open") },
+		{ GET_MEMBER_NAME_CHECKED(FActorIOImportBenchmarkParams, StringParam), TEXT("Hello World") },
+		{ GET_MEMBER_NAME_CHECKED(FActorIOImportBenchmarkParams, EnumParam), TEXT("Second") },
+		{ GET_MEMBER_NAME_CHECKED(FActorIOImportBenchmarkParams, ObjectParam), ObjectPath },
+		{ GET_MEMBER_NAME_CHECKED(FActorIOImportBenchmarkParams, VectorParam), TEXT("(X=1.0,Y=-2.5,Z=300.0)") },
+		{ GET_MEMBER_NAME_CHECKED(FActorIOImportBenchmarkParams, ColorParam), TEXT("(R=1.0,G=0.5,B=0.25,A=1.0)") },
+	};
+
+	UScriptStruct* ParamsStruct = FActorIOImportBenchmarkParams::StaticStruct();
+	TArray<TSharedPtr<FJsonValue>> ResultsJson;
+	bool bAllMatch = true;
+
+	for (const TPair<FName, FString>& Case : Cases)
+	{
+		const FProperty* Property = ParamsStruct->FindPropertyByName(Case.Key);
+		check(Property);
+
+		// Both importers get their own copies of the argument, created outside of the measurement.
+		// The specialized string importer moves the argument, so the copies can't be reused between iterations.
+		TArray<FString> Arguments;
+		Arguments.Init(Case.Value, NumIterations);
+
+		FActorIOImportBenchmarkParams GenericParams;
+		FBenchmarkStage GenericStage;
+		GenericStage.NumOps = NumIterations;
+		{
+			ActorIOBenchmark::FScopedStageMeasurement Measurement(GenericStage.Seconds, GenericStage.NumAllocations);
+			for (const FString& Argument : Arguments)
+			{
+				Property->ImportText_InContainer(*Argument, &GenericParams, nullptr, PPF_None);
+			}
+		}
+
+		Arguments.Init(Case.Value, NumIterations);
+
+		FActorIOImportBenchmarkParams FastParams;
+		FBenchmarkStage FastStage;
+		FastStage.NumOps = NumIterations;
+		int32 NumFastImports = 0;
+		{
+			ActorIOBenchmark::FScopedStageMeasurement Measurement(FastStage.Seconds, FastStage.NumAllocations);
+			for (FString& Argument : Arguments)
+			{
+				if (FActorIOArgumentImporter::TryImport(Property, Argument, &FastParams))
+				{
+					++NumFastImports;
+				}
+			}
+		}
+
+		const bool bMatch = Property->Identical_InContainer(&GenericParams, &FastParams);
+		if (!bMatch)
+		{
+			UE_LOG(LogActorIOBenchmark, Error, TEXT("Importers produced different values for '%s' (%s)."), *Case.Value, *Property->GetClass()->GetName());
+			bAllMatch = false;
+		}
+
+		TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+		ResultJson->SetStringField(TEXT("type"), Property->GetCPPType());
+		ResultJson->SetStringField(TEXT("argument"), Case.Value);
+		ResultJson->SetObjectField(TEXT("generic"), MakeStageJson(GenericStage));
+		ResultJson->SetObjectField(TEXT("fast"), MakeStageJson(FastStage));
+		ResultJson->SetNumberField(TEXT("speedup"), FastStage.Seconds > 0.0 ? GenericStage.Seconds / FastStage.Seconds : 0.0);
+		ResultJson->SetBoolField(TEXT("fastPathTaken"), NumFastImports == NumIterations);
+		ResultJson->SetBoolField(TEXT("match"), bMatch);
+		ResultsJson.Add(MakeShared<FJsonValueObject>(ResultJson));
+	}
+
+	OutJson = MakeShared<FJsonObject>();
+	OutJson->SetNumberField(TEXT("iterations"), NumIterations);
+	OutJson->SetArrayField(TEXT("results"), ResultsJson);
+
+	return bAllMatch;
+}
+
+void UActorIOBenchmarkCommandlet::CreateBenchmarkWorld(const FBenchmarkSettings& Settings, FBenchmarkStage& OutBindStage)
+{
+	check(!BenchmarkWorld);
+
+	BenchmarkWorld = UWorld::CreateWorld(EWorldType::Game, false, TEXT("ActorIOBenchmarkWorld"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(BenchmarkWorld);
+
+	// No game mode is needed. We only want the world to begin play so that actors and components are fully initialized.
+	BenchmarkWorld->InitializeActorsForPlay(FURL());
+	BenchmarkWorld->BeginPlay();
+
+	// Messages are only delivered in active levels.
+	// In case of manual level activation, the benchmark activates the persistent level itself.
+	UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(BenchmarkWorld);
+	check(IOSubsystem);
+	IOSubsystem->ActivateLevel(BenchmarkWorld->PersistentLevel);
+
+	FRandomStream RandomStream = FRandomStream(Settings.Seed);
+
+	SinkActors.Reset(Settings.NumSinks);
+	for (int32 SinkIdx = 0; SinkIdx != Settings.NumSinks; ++SinkIdx)
+	{
+		SinkActors.Add(BenchmarkWorld->SpawnActor<ALogicCounter>());
+	}
+
+	SourceActors.Reset(Settings.NumActors);
+	for (int32 ActorIdx = 0; ActorIdx != Settings.NumActors; ++ActorIdx)
+	{
+		ALogicCounter* SourceActor = BenchmarkWorld->SpawnActor<ALogicCounter>();
+		SourceActors.Add(SourceActor);
+
+		UActorIOComponent* IOComponent = NewObject<UActorIOComponent>(SourceActor, TEXT("ActorIOComponent"));
+		for (int32 ActionIdx = 0; ActionIdx != Settings.NumActionsPerActor; ++ActionIdx)
+		{
+			UActorIOAction* NewAction = IOComponent->CreateNewAction();
+			NewAction->EventId = ActionIdx < Settings.FanOut ? ActorIOBenchmark::FiredEventId : ActorIOBenchmark::IdleEventId;
+			NewAction->TargetActor = SinkActors[RandomStream.RandHelper(SinkActors.Num())].Get();
+			NewAction->FunctionId = ActorIOBenchmark::TargetFunctionId;
+			NewAction->FunctionArguments = RandomStream.FRand() < Settings.NamedArgShare ? TEXT("$Value") : TEXT("1");
+			NewAction->Delay = RandomStream.FRand() < Settings.DelayedShare ? RandomStream.FRandRange(0.0f, Settings.MaxDelay) : 0.0f;
+		}
+
+		// Components in the synthetic world are not loaded from a package, so they are clustered the same way the loader would.
+		if (IOComponent->CanBeClusterRoot())
+		{
+			IOComponent->CreateCluster();
+		}
+
+		// Registering the component initializes it, which binds all actions to their events.
+		ActorIOBenchmark::FScopedStageMeasurement Measurement(OutBindStage.Seconds, OutBindStage.NumAllocations);
+		SourceActor->AddInstanceComponent(IOComponent);
+		IOComponent->RegisterComponent();
+	}
+
+	OutBindStage.NumOps = static_cast<int64>(Settings.NumActors) * Settings.NumActionsPerActor;
+}
+
+void UActorIOBenchmarkCommandlet::DestroyBenchmarkWorld(FBenchmarkStage& OutUnbindStage)
+{
+	check(BenchmarkWorld);
+
+	for (ALogicCounter* SourceActor : SourceActors)
+	{
+		UActorIOComponent* IOComponent = SourceActor->FindComponentByClass<UActorIOComponent>();
+		if (IOComponent)
+		{
+			OutUnbindStage.NumOps += IOComponent->GetNumActions();
+
+			// Destroying the component uninitializes it, which unbinds all actions.
+			ActorIOBenchmark::FScopedStageMeasurement Measurement(OutUnbindStage.Seconds, OutUnbindStage.NumAllocations);
+			IOComponent->DestroyComponent();
+		}
+	}
+
+	SourceActors.Reset();
+	SinkActors.Reset();
+
+	BenchmarkWorld->DestroyWorld(false);
+	GEngine->DestroyWorldContext(BenchmarkWorld);
+	BenchmarkWorld = nullptr;
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+int64 UActorIOBenchmarkCommandlet::GetPendingMessagesMemory() const
+{
+	UActorIOSubsystemBase* IOSubsystem = UActorIOSubsystemBase::Get(BenchmarkWorld);
+	if (!IOSubsystem)
+	{
+		return 0;
+	}
+
+	const TArray<FActorIOMessage>& PendingMessages = IOSubsystem->GetPendingMessages();
+
+	int64 OutMemory = PendingMessages.GetAllocatedSize();
+	for (const FActorIOMessage& Message : PendingMessages)
+	{
+		OutMemory += Message.Arguments.GetAllocatedSize();
+	}
+
+	return OutMemory;
+}
+
+TSharedPtr<FJsonObject> UActorIOBenchmarkCommandlet::MakeStageJson(const FBenchmarkStage& Stage)
+{
+	TSharedPtr<FJsonObject> StageJson = MakeShared<FJsonObject>();
+	StageJson->SetNumberField(TEXT("seconds"), Stage.Seconds);
+	StageJson->SetNumberField(TEXT("ops"), Stage.NumOps);
+	StageJson->SetNumberField(TEXT("nsPerOp"), Stage.NumOps > 0 ? Stage.Seconds * 1e9 / Stage.NumOps : 0.0);
+	StageJson->SetNumberField(TEXT("allocations"), Stage.NumAllocations);
+	StageJson->SetNumberField(TEXT("allocationsPerOp"), Stage.NumOps > 0 ? static_cast<double>(Stage.NumAllocations) / Stage.NumOps : 0.0);
+	return StageJson;
+}
@@ -0,0 +1,348 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "Commandlets/ActorIOStressLevelCommandlet.h"
+#include "ActorIO.h"
+#include "ActorIOComponent.h"
+#include "ActorIOAction.h"
+#include "LogicActors/LogicRelay.h"
+#include "LogicActors/LogicCounter.h"
+#include "LogicActors/LogicTimer.h"
+#include "LogicActors/LogicBranch.h"
+#include "Engine/TriggerBox.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreamingDynamic.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "Misc/PackageName.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogActorIOStressLevel, Log, All);
+
+namespace ActorIOStressLevel
+{
+	/** Distance between actors placed in the level grid. */
+	static constexpr float GridSpacing = 200.0f;
+
+	/**
+	 * I/O functions that are never used by generated actions.
+	 * Destroying actors would make the map change shape on every run, which makes profiling results unreliable.
+	 */
+	static const FName ExcludedFunctionIds[] =
+	{
+		TEXT("AActor::Destroy"),
+	};
+}
+
+UActorIOStressLevelCommandlet::UActorIOStressLevelCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+
+	RandomStream = FRandomStream();
+}
+
+UActorIOStressLevelCommandlet::FStressLevelSettings UActorIOStressLevelCommandlet::ParseSettings(const FString& Params)
+{
+	FStressLevelSettings Settings;
+	const TCHAR* Str = *Params;
+
+	FParse::Value(Str, TEXT("Map="), Settings.MapPackageName);
+	FParse::Value(Str, TEXT("Sublevels="), Settings.NumSublevels);
+	FParse::Value(Str, TEXT("Relays="), Settings.NumRelays);
+	FParse::Value(Str, TEXT("Counters="), Settings.NumCounters);
+	FParse::Value(Str, TEXT("Timers="), Settings.NumTimers);
+	FParse::Value(Str, TEXT("Branches="), Settings.NumBranches);
+	FParse::Value(Str, TEXT("Triggers="), Settings.NumTriggers);
+	FParse::Value(Str, TEXT("ActionsPerActor="), Settings.NumActionsPerActor);
+	FParse::Value(Str, TEXT("CrossLevelShare="), Settings.CrossLevelShare);
+	FParse::Value(Str, TEXT("DelayedShare="), Settings.DelayedShare);
+	FParse::Value(Str, TEXT("MaxDelay="), Settings.MaxDelay);
+	FParse::Value(Str, TEXT("NamedArgShare="), Settings.NamedArgShare);
+	FParse::Value(Str, TEXT("Seed="), Settings.Seed);
+
+	Settings.NumSublevels = FMath::Max(Settings.NumSublevels, 1);
+	Settings.NumRelays = FMath::Max(Settings.NumRelays, 0);
+	Settings.NumCounters = FMath::Max(Settings.NumCounters, 0);
+	Settings.NumTimers = FMath::Max(Settings.NumTimers, 0);
+	Settings.NumBranches = FMath::Max(Settings.NumBranches, 0);
+	Settings.NumTriggers = FMath::Max(Settings.NumTriggers, 0);
+	Settings.NumActionsPerActor = FMath::Max(Settings.NumActionsPerActor, 0);
+	Settings.CrossLevelShare = FMath::Clamp(Settings.CrossLevelShare, 0.0f, 1.0f);
+	Settings.DelayedShare = FMath::Clamp(Settings.DelayedShare, 0.0f, 1.0f);
+	Settings.MaxDelay = FMath::Max(Settings.MaxDelay, 0.0f);
+	Settings.NamedArgShare = FMath::Clamp(Settings.NamedArgShare, 0.0f, 1.0f);
+
+	return Settings;
+}
+
+int32 UActorIOStressLevelCommandlet::Main(const FString& Params)
+{
+	const FStressLevelSettings Settings = ParseSettings(Params);
+	RandomStream.Initialize(Settings.Seed);
+
+	if (!FPackageName::IsValidLongPackageName(Settings.MapPackageName))
+	{
+		UE_LOG(LogActorIOStressLevel, Error, TEXT("Invalid map package name '%s'."), *Settings.MapPackageName);
+		return 1;
+	}
+
+	FStressLevel PersistentLevel = CreateLevel(Settings.MapPackageName);
+
+	// Create and populate all sublevels before wiring them together.
+	// Actions may target actors in any sublevel, so every actor must exist before the first action is created.
+	TArray<FStressLevel> Sublevels;
+	for (int32 SublevelIdx = 0; SublevelIdx != Settings.NumSublevels; ++SublevelIdx)
+	{
+		const FString SublevelPackageName = FString::Printf(TEXT("%s_Sub%d"), *Settings.MapPackageName, SublevelIdx);
+		FStressLevel& Sublevel = Sublevels.Add_GetRef(CreateLevel(SublevelPackageName));
+		SpawnActors(Settings, Sublevel);
+	}
+
+	int32 NumActions = 0;
+	for (FStressLevel& Sublevel : Sublevels)
+	{
+		CreateActions(Settings, Sublevel, Sublevels, NumActions);
+	}
+
+	// Add the sublevels to the persistent level.
+	// They are loaded and made visible automatically when the map is opened.
+	for (const FStressLevel& Sublevel : Sublevels)
+	{
+		ULevelStreamingDynamic* StreamingLevel = NewObject<ULevelStreamingDynamic>(PersistentLevel.World, NAME_None, RF_NoFlags);
+		StreamingLevel->SetWorldAssetByPackageName(Sublevel.Package->GetFName());
+		StreamingLevel->bInitiallyLoaded = true;
+		StreamingLevel->bInitiallyVisible = true;
+		PersistentLevel.World->AddStreamingLevel(StreamingLevel);
+	}
+
+	bool bSuccess = true;
+	for (const FStressLevel& Sublevel : Sublevels)
+	{
+		bSuccess &= SaveLevel(Sublevel);
+	}
+
+	bSuccess &= SaveLevel(PersistentLevel);
+
+	int32 NumActors = 0;
+	for (const FStressLevel& Sublevel : Sublevels)
+	{
+		NumActors += Sublevel.Actors.Num();
+	}
+
+	UE_LOG(LogActorIOStressLevel, Display, TEXT("Generated map '%s' with [%d] sublevels, [%d] actors and [%d] actions (Seed: %d)."), *Settings.MapPackageName, Sublevels.Num(), NumActors, NumActions, Settings.Seed);
+
+	for (FStressLevel& Sublevel : Sublevels)
+	{
+		Sublevel.World->RemoveFromRoot();
+		Sublevel.World->DestroyWorld(false);
+	}
+
+	PersistentLevel.World->RemoveFromRoot();
+	PersistentLevel.World->DestroyWorld(false);
+
+	return bSuccess ? 0 : 1;
+}
+
+UActorIOStressLevelCommandlet::FStressLevel UActorIOStressLevelCommandlet::CreateLevel(const FString& PackageName)
+{
+	FStressLevel OutLevel;
+	OutLevel.Package = CreatePackage(*PackageName);
+	OutLevel.Package->SetPackageFlags(PKG_NewlyCreated);
+
+	// Using an editor world so that the I/O subsystem exists, and native events and functions are registered for the actors.
+	const FName WorldName = FName(*FPackageName::GetShortName(PackageName));
+	OutLevel.World = UWorld::CreateWorld(EWorldType::Editor, false, WorldName, OutLevel.Package);
+	OutLevel.World->SetFlags(RF_Public | RF_Standalone);
+
+	// Keep the world around until the whole map is generated and saved.
+	OutLevel.World->AddToRoot();
+
+	return OutLevel;
+}
+
+void UActorIOStressLevelCommandlet::SpawnActors(const FStressLevelSettings& Settings, FStressLevel& Level)
+{
+	TArray<UClass*> ActorClasses;
+	auto AddActorClass = [&ActorClasses](UClass* InClass, int32 InCount)
+	{
+		for (int32 Idx = 0; Idx != InCount; ++Idx)
+		{
+			ActorClasses.Add(InClass);
+		}
+	};
+
+	AddActorClass(ALogicRelay::StaticClass(), Settings.NumRelays);
+	AddActorClass(ALogicCounter::StaticClass(), Settings.NumCounters);
+	AddActorClass(ALogicTimer::StaticClass(), Settings.NumTimers);
+	AddActorClass(ALogicBranch::StaticClass(), Settings.NumBranches);
+	AddActorClass(ATriggerBox::StaticClass(), Settings.NumTriggers);
+
+	const int32 GridSize = FMath::Max(FMath::CeilToInt(FMath::Sqrt(static_cast<float>(ActorClasses.Num()))), 1);
+
+	Level.Actors.Reserve(ActorClasses.Num());
+	for (int32 ActorIdx = 0; ActorIdx != ActorClasses.Num(); ++ActorIdx)
+	{
+		const FVector Location = FVector((ActorIdx % GridSize) * ActorIOStressLevel::GridSpacing, (ActorIdx / GridSize) * ActorIOStressLevel::GridSpacing, 0.0f);
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		AActor* NewActor = Level.World->SpawnActor<AActor>(ActorClasses[ActorIdx], Location, FRotator::ZeroRotator, SpawnParams);
+		if (NewActor)
+		{
+			Level.Actors.Add(NewActor);
+		}
+	}
+}
+
+void UActorIOStressLevelCommandlet::CreateActions(const FStressLevelSettings& Settings, FStressLevel& Level, const TArray<FStressLevel>& AllLevels, int32& OutNumActions)
+{
+	for (AActor* SourceActor : Level.Actors)
+	{
+		const FActorIOEventList ValidEvents = IActorIO::GetEventsForObject(SourceActor);
+		if (ValidEvents.GetEvents().Num() == 0)
+		{
+			continue;
+		}
+
+		const int32 NumActions = RandomStream.RandRange(0, Settings.NumActionsPerActor * 2);
+		if (NumActions == 0)
+		{
+			continue;
+		}
+
+		UActorIOComponent* IOComponent = NewObject<UActorIOComponent>(SourceActor, TEXT("ActorIOComponent"), RF_Transactional);
+		SourceActor->AddInstanceComponent(IOComponent);
+
+		for (int32 ActionIdx = 0; ActionIdx != NumActions; ++ActionIdx)
+		{
+			// Pick the target level first so that cross level actions are distributed evenly.
+			const FStressLevel* TargetLevel = &Level;
+			if (AllLevels.Num() > 1 && RandomStream.FRand() < Settings.CrossLevelShare)
+			{
+				TargetLevel = &AllLevels[RandomStream.RandHelper(AllLevels.Num())];
+			}
+
+			if (TargetLevel->Actors.Num() == 0)
+			{
+				continue;
+			}
+
+			AActor* TargetActor = TargetLevel->Actors[RandomStream.RandHelper(TargetLevel->Actors.Num())];
+
+			const FActorIOFunctionList ValidFunctions = IActorIO::GetFunctionsForObject(TargetActor);
+			TArray<const FActorIOFunction*> CandidateFunctions;
+			for (const FActorIOFunction& Function : ValidFunctions.GetFunctions())
+			{
+				bool bExcluded = false;
+				for (const FName& ExcludedFunctionId : ActorIOStressLevel::ExcludedFunctionIds)
+				{
+					bExcluded |= Function.FunctionId == ExcludedFunctionId;
+				}
+
+				if (!bExcluded)
+				{
+					CandidateFunctions.Add(&Function);
+				}
+			}
+
+			if (CandidateFunctions.Num() == 0)
+			{
+				continue;
+			}
+
+			const FActorIOEvent& SourceEvent = ValidEvents.GetEvents()[RandomStream.RandHelper(ValidEvents.GetEvents().Num())];
+			const FActorIOFunction* TargetFunction = CandidateFunctions[RandomStream.RandHelper(CandidateFunctions.Num())];
+
+			UActorIOAction* NewAction = IOComponent->CreateNewAction();
+			NewAction->EventId = SourceEvent.EventId;
+			NewAction->TargetActor = TargetActor;
+			NewAction->FunctionId = TargetFunction->FunctionId;
+			NewAction->Delay = RandomStream.FRand() < Settings.DelayedShare ? RandomStream.FRandRange(0.0f, Settings.MaxDelay) : 0.0f;
+			NewAction->bExecuteOnlyOnce = RandomStream.FRand() < 0.1f;
+
+			UFunction* Function = NewAction->ResolveUFunction(TargetFunction);
+			if (Function)
+			{
+				NewAction->FunctionArguments = GenerateArguments(Settings, Function, SourceActor);
+			}
+
+			++OutNumActions;
+		}
+
+		IOComponent->RegisterComponent();
+	}
+}
+
+FString UActorIOStressLevelCommandlet::GenerateArguments(const FStressLevelSettings& Settings, UFunction* Function, AActor* Caller)
+{
+	// Named arguments are only generated where the caller is guaranteed to provide them.
+	const bool bCallerHasValueArgument = Caller->IsA<ALogicCounter>();
+
+	TArray<FString> Arguments;
+	for (TFieldIterator<FProperty> It(Function); It && (It->PropertyFlags & (CPF_Parm | CPF_ReturnParm)) == CPF_Parm; ++It)
+	{
+		FProperty* Param = *It;
+
+		// Out params that are not passed by ref do not take an input value.
+		// @see UActorIOSubsystemBase::ExecuteCommand
+		if (Param->HasAnyPropertyFlags(CPF_OutParm) && !Param->HasAnyPropertyFlags(CPF_ReferenceParm))
+		{
+			continue;
+		}
+
+		if (Param->IsA<FBoolProperty>())
+		{
+			Arguments.Add(RandomStream.FRand() < 0.5f ? TEXT("true") : TEXT("false"));
+		}
+		else if (Param->IsA<FIntProperty>())
+		{
+			if (bCallerHasValueArgument && RandomStream.FRand() < Settings.NamedArgShare)
+			{
+				Arguments.Add(TEXT("$Value"));
+			}
+			else
+			{
+				Arguments.Add(FString::FromInt(RandomStream.RandRange(0, 10)));
+			}
+		}
+		else if (Param->IsA<FFloatProperty>() || Param->IsA<FDoubleProperty>())
+		{
+			Arguments.Add(FString::SanitizeFloat(FMath::RoundToFloat(RandomStream.FRandRange(0.0f, 5.0f) * 100.0f) / 100.0f));
+		}
+		else if (Param->IsA<FStrProperty>() || Param->IsA<FNameProperty>() || Param->IsA<FTextProperty>())
+		{
+			Arguments.Add(TEXT("Stress"));
+		}
+		else
+		{
+			// Arguments are read by position, and an empty argument does not keep its place in the final command, so it would shift the following ones.
+			// Stop at the first type that can't be generated, so that it and the remaining params use their default values.
+			break;
+		}
+	}
+
+	return FString::Join(Arguments, TEXT("; "));
+}
+
+bool UActorIOStressLevelCommandlet::SaveLevel(const FStressLevel& Level)
+{
+	const FString PackageName = Level.Package->GetName();
+	const FString Filename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetMapPackageExtension());
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_NoError;
+
+	if (!UPackage::SavePackage(Level.Package, Level.World, *Filename, SaveArgs))
+	{
+		UE_LOG(LogActorIOStressLevel, Error, TEXT("Failed to save level '%s'."), *PackageName);
+		return false;
+	}
+
+	UE_LOG(LogActorIOStressLevel, Display, TEXT("Saved level '%s'."), *Filename);
+	return true;
+}
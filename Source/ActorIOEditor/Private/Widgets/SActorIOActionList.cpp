@@ -895,7 +895,7 @@ void SActorIOActionListViewRow::UpdateSelectableEvents()
 	if (ActionPtr.IsValid())
 	{
 		ValidEvents = IActorIO::GetEventsForObject(ActionPtr->GetOwnerActor());
-		for (const FActorIOEvent& IOEvent : ValidEvents.EventRegistry)
+		for (const FActorIOEvent& IOEvent : ValidEvents.GetEvents())
 		{
 			SelectableEventIds.Emplace(IOEvent.EventId);
 		}
@@ -913,7 +913,7 @@ void SActorIOActionListViewRow::UpdateSelectableFunctions()
 	if (ActionPtr.IsValid())
 	{
 		ValidFunctions = IActorIO::GetFunctionsForObject(ActionPtr->TargetActor.Get());
-		for (const FActorIOFunction& IOFunction : ValidFunctions.FunctionRegistry)
+		for (const FActorIOFunction& IOFunction : ValidFunctions.GetFunctions())
 		{
 			SelectableFunctionIds.Emplace(IOFunction.FunctionId);
 		}
@@ -9,6 +9,9 @@
 
 class AActor;
 class UActorIOComponent;
+class UBlueprint;
+class UPackage;
+class FObjectPostSaveContext;
 
 /**
  * Editor subsystem for integrating the level editor, and other editor features with the Actor I/O plugin.
@@ -34,6 +37,9 @@ private:
 	/** The currently selected actor in the level editor. */
 	TWeakObjectPtr<AActor> SelectedActor;
 
+	/** Blueprints that are being compiled, and should have their I/O registrations captured once compiled. */
+	TArray<TWeakObjectPtr<UBlueprint>> CompilingBlueprints;
+
 	/** Handle for when a new object is selected in the editor. */
 	FDelegateHandle DelegateHandle_SelectionChanged;
 	/** Handle for when an actor is deleted in the level editor. */
@@ -42,8 +48,12 @@ private:
 	FDelegateHandle DelegateHandle_CutActorsBegin;
 	/** Handle for when an actor is replaced in the level editor. */
 	FDelegateHandle DelegateHandle_ActorReplaced;
+	/** Handle for when a blueprint is about to be compiled in the editor. */
+	FDelegateHandle DelegateHandle_BlueprintPreCompile;
 	/** Handle for when a blueprint is compiled in the editor. */
 	FDelegateHandle DelegateHandle_BlueprintCompiled;
+	/** Handle for when a package is saved. */
+	FDelegateHandle DelegateHandle_PackageSaved;
 
 private:
 
@@ -56,9 +66,18 @@ private:
 	/** Called when an actor is replaced in the level editor. */
 	void OnActorReplaced(AActor* OldActor, AActor* NewActor);
 
+	/** Called when a blueprint is about to be compiled in the editor. */
+	void OnBlueprintPreCompile(UBlueprint* Blueprint);
+
 	/** Called when a blueprint is compiled in the editor. */
 	void OnBlueprintCompiled();
 
+	/** Capture the I/O registrations of the compiled blueprints into the class registry from the Actor I/O settings. */
+	void CaptureCompiledBlueprints();
+
+	/** Called when a package is saved. Used to restore I/O components after their level was cooked in the editor. */
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+
 public:
 
 	//~ Begin UEditorSubsystem Interface
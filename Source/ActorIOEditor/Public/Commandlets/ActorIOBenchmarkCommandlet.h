@@ -0,0 +1,193 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ActorIOBenchmarkCommandlet.generated.h"
+
+class UWorld;
+class ALogicCounter;
+class FJsonObject;
+
+/** Enum parameter of the argument import benchmark. */
+UENUM()
+enum class EActorIOImportBenchmarkEnum : uint8
+{
+	First,
+	Second,
+	Third
+};
+
+/** Parameters of the argument import benchmark. One property for each parameter type that has a specialized importer. */
+USTRUCT()
+struct FActorIOImportBenchmarkParams
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	bool BoolParam = false;
+
+	UPROPERTY()
+	int32 IntParam = 0;
+
+	UPROPERTY()
+	float FloatParam = 0.0f;
+
+	UPROPERTY()
+	double DoubleParam = 0.0;
+
+	UPROPERTY()
+	FName NameParam;
+
+	UPROPERTY()
+	FString StringParam;
+
+	UPROPERTY()
+	EActorIOImportBenchmarkEnum EnumParam = EActorIOImportBenchmarkEnum::First;
+
+	UPROPERTY()
+	TObjectPtr<UObject> ObjectParam;
+
+	UPROPERTY()
+	FVector VectorParam = FVector::ZeroVector;
+
+	UPROPERTY()
+	FLinearColor ColorParam = FLinearColor::Black;
+};
+
+/**
+ * Headless throughput benchmark for the I/O system.
+ * Builds a synthetic world in memory, fires I/O events for a fixed number of frames, and reports the results as JSON.
+ *
+ * Usage: UnrealEditor-Cmd.exe <Project> -run=ActorIOBenchmark [options]
+ *
+ *   -Actors=<int>          Number of source actors that fire events every frame. (default: 1000)
+ *   -Actions=<int>         Number of actions per source actor. (default: 8)
+ *   -FanOut=<int>          Number of actions per source actor that are bound to the fired event. The rest are bound but idle. (default: 4)
+ *   -Sinks=<int>           Number of target actors receiving the messages. (default: Actors / 4)
+ *   -Frames=<int>          Number of frames to simulate. (default: 120)
+ *   -DeltaTime=<float>     Fixed frame time in seconds. (default: 1/60)
+ *   -DelayedShare=<float>  Share of actions [0-1] that have a delay. (default: 0.5)
+ *   -MaxDelay=<float>      Maximum delay of delayed actions in seconds. Delays are uniformly distributed. (default: 1.0)
+ *   -NamedArgShare=<float> Share of actions [0-1] that use a named argument instead of a literal. (default: 0.25)
+ *   -Seed=<int>            Seed of the random stream used to build the world. (default: 0)
+ *   -Variants=<list>       Comma separated list of benchmark variants to run. (default: Default)
+ *   -Output=<path>         File to write the JSON report to. If not set, the report is written to the log.
+ *
+ *   -ScalingSweep          Also measure the per-message cost of ticking and removing pending messages at different queue sizes.
+ *   -ScalingCounts=<list>  Comma separated list of pending message counts to measure. (default: 1000,10000,100000)
+ *   -ScalingTolerance=<float> Fail the commandlet if the per-message cost at the largest count exceeds the cost at the smallest count
+ *                          by more than this factor. Zero disables the check. (default: 3)
+ *
+ *   -ImportBenchmark       Also compare the specialized argument importers with the generic property text importer.
+ *                          Fails the commandlet if the two importers produce different values, including for edge cases
+ *                          that the specialized importers leave to the generic importer (e.g. out of range integers).
+ *   -ImportIterations=<int> Number of times each argument is imported. (default: 100000)
+ */
+UCLASS()
+class UActorIOBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Default constructor. */
+	UActorIOBenchmarkCommandlet();
+
+protected:
+
+	/** Settings of a benchmark run, parsed from the command line. */
+	struct FBenchmarkSettings
+	{
+		int32 NumActors = 1000;
+		int32 NumActionsPerActor = 8;
+		int32 FanOut = 4;
+		int32 NumSinks = 250;
+		int32 NumFrames = 120;
+		float DeltaTime = 1.0f / 60.0f;
+		float DelayedShare = 0.5f;
+		float MaxDelay = 1.0f;
+		float NamedArgShare = 0.25f;
+		int32 Seed = 0;
+	};
+
+	/**
+	 * A named set of console variable overrides that the benchmark is run with.
+	 * Used to compare the legacy paths of the I/O system with the fast paths.
+	 */
+	struct FBenchmarkVariant
+	{
+		/** Name of the variant as given in the -Variants param. */
+		const TCHAR* Name;
+
+		/** Console variables to set before running the variant, in the form of "Name=Value". */
+		TArray<const TCHAR*> ConsoleVariables;
+	};
+
+	/** Measured results of a single stage (e.g. binding, dispatching, ticking). */
+	struct FBenchmarkStage
+	{
+		/** Total time spent in the stage. */
+		double Seconds = 0.0;
+
+		/** Number of operations performed in the stage. */
+		int64 NumOps = 0;
+
+		/** Number of heap allocations made during the stage. */
+		int64 NumAllocations = 0;
+	};
+
+	/** The world that the benchmark is running in. */
+	UPROPERTY(Transient)
+	TObjectPtr<UWorld> BenchmarkWorld;
+
+	/** Actors firing the events. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ALogicCounter>> SourceActors;
+
+	/** Actors receiving the messages. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ALogicCounter>> SinkActors;
+
+protected:
+
+	/** @return List of variants that the benchmark can run. */
+	static const TArray<FBenchmarkVariant>& GetBenchmarkVariants();
+
+	/** Parse the benchmark settings from the commandlet params. */
+	static FBenchmarkSettings ParseSettings(const FString& Params);
+
+	/** Run the benchmark with the given variant, and collect the results into a JSON object. */
+	TSharedPtr<FJsonObject> RunVariant(const FBenchmarkSettings& Settings, const FBenchmarkVariant& Variant);
+
+	/**
+	 * Measure the per-message cost of ticking and removing pending messages at different queue sizes.
+	 * @return Whether the cost stayed within the given tolerance.
+	 */
+	bool RunScalingSweep(const FBenchmarkSettings& Settings, const TArray<int32>& PendingCounts, float Tolerance, TSharedPtr<FJsonObject>& OutJson);
+
+	/**
+	 * Measure the cost of importing common argument types with the specialized importers and with the generic importer.
+	 * @return Whether both importers produced the same values.
+	 */
+	bool RunImportBenchmark(int32 NumIterations, TSharedPtr<FJsonObject>& OutJson);
+
+	/** Create the synthetic world with all actors and actions. */
+	void CreateBenchmarkWorld(const FBenchmarkSettings& Settings, FBenchmarkStage& OutBindStage);
+
+	/** Destroy the synthetic world. */
+	void DestroyBenchmarkWorld(FBenchmarkStage& OutUnbindStage);
+
+	/** @return Memory used by the pending message queue of the I/O subsystem in bytes. */
+	int64 GetPendingMessagesMemory() const;
+
+	/** Convert the results of a stage into a JSON object. */
+	static TSharedPtr<FJsonObject> MakeStageJson(const FBenchmarkStage& Stage);
+
+public:
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
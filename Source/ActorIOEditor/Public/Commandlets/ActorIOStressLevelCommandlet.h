@@ -0,0 +1,112 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Math/RandomStream.h"
+#include "ActorIOStressLevelCommandlet.generated.h"
+
+class UWorld;
+class UPackage;
+class UFunction;
+
+/**
+ * Generates a stress test map for the I/O system.
+ * The map is made of a persistent level and several streaming sublevels that are filled with logic actors and trigger boxes,
+ * wired together with randomized but reproducible I/O actions. Actions may target actors in other sublevels.
+ * Use this to profile load time, bind time, editor responsiveness and runtime dispatch with large amounts of actions.
+ *
+ * Usage: UnrealEditor-Cmd.exe <Project> -run=ActorIOStressLevel [options]
+ *
+ *   -Map=<package>           Long package name of the persistent level to create. (default: /Game/ActorIOStress/ActorIOStress)
+ *   -Sublevels=<int>         Number of streaming sublevels to distribute the actors in. (default: 4)
+ *   -Relays=<int>            Number of relays per sublevel. (default: 500)
+ *   -Counters=<int>          Number of counters per sublevel. (default: 500)
+ *   -Timers=<int>            Number of timers per sublevel. (default: 250)
+ *   -Branches=<int>          Number of branches per sublevel. (default: 250)
+ *   -Triggers=<int>          Number of trigger boxes per sublevel. (default: 100)
+ *   -ActionsPerActor=<int>   Average number of actions per actor. (default: 4)
+ *   -CrossLevelShare=<float> Share of actions [0-1] that target an actor in a different sublevel. (default: 0.1)
+ *   -DelayedShare=<float>    Share of actions [0-1] that have a delay. (default: 0.25)
+ *   -MaxDelay=<float>        Maximum delay of delayed actions in seconds. (default: 2.0)
+ *   -NamedArgShare=<float>   Share of eligible arguments [0-1] that use a named argument instead of a literal. (default: 0.25)
+ *   -Seed=<int>              Seed of the random stream. The same seed and options always generate the same map. (default: 0)
+ *
+ * World Partition maps are not generated. Streaming is done with regular sublevels.
+ */
+UCLASS()
+class UActorIOStressLevelCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Default constructor. */
+	UActorIOStressLevelCommandlet();
+
+protected:
+
+	/** Settings of the generated map, parsed from the command line. */
+	struct FStressLevelSettings
+	{
+		FString MapPackageName = TEXT("/Game/ActorIOStress/ActorIOStress");
+		int32 NumSublevels = 4;
+		int32 NumRelays = 500;
+		int32 NumCounters = 500;
+		int32 NumTimers = 250;
+		int32 NumBranches = 250;
+		int32 NumTriggers = 100;
+		int32 NumActionsPerActor = 4;
+		float CrossLevelShare = 0.1f;
+		float DelayedShare = 0.25f;
+		float MaxDelay = 2.0f;
+		float NamedArgShare = 0.25f;
+		int32 Seed = 0;
+	};
+
+	/** A level that is being generated. */
+	struct FStressLevel
+	{
+		/** Package of the level. */
+		UPackage* Package = nullptr;
+
+		/** The world of the level. */
+		UWorld* World = nullptr;
+
+		/** Actors spawned in the level. */
+		TArray<AActor*> Actors;
+	};
+
+	/** Random stream used for everything that is generated. */
+	FRandomStream RandomStream;
+
+protected:
+
+	/** Parse the map settings from the commandlet params. */
+	static FStressLevelSettings ParseSettings(const FString& Params);
+
+	/** Create a new world in its own package. */
+	static FStressLevel CreateLevel(const FString& PackageName);
+
+	/** Spawn the actors of a sublevel. */
+	void SpawnActors(const FStressLevelSettings& Settings, FStressLevel& Level);
+
+	/** Wire the actors of a sublevel with I/O actions. */
+	void CreateActions(const FStressLevelSettings& Settings, FStressLevel& Level, const TArray<FStressLevel>& AllLevels, int32& OutNumActions);
+
+	/**
+	 * Generate arguments for the given function, based on the types of its parameters.
+	 * Stops at the first parameter of an unsupported type, so the rest of the parameters get no argument.
+	 */
+	FString GenerateArguments(const FStressLevelSettings& Settings, UFunction* Function, AActor* Caller);
+
+	/** Save the level to disk. */
+	static bool SaveLevel(const FStressLevel& Level);
+
+public:
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
@@ -0,0 +1,90 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "Misc/AutomationTest.h"
+#include "ActorIOTestTypes.h"
+#include "ActorIOArgumentImporter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ActorIOArgumentImporterSpec
+{
+	/** An argument, and the parameter it is imported into. */
+	struct FImportCase
+	{
+		FName PropertyName;
+		FString Argument;
+	};
+}
+
+BEGIN_DEFINE_SPEC(FActorIOArgumentImporterSpec, "ActorIO.ArgumentImporter", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+	/** Import the argument with both the specialized and the generic importer, and test that the results are the same. */
+	void TestSameAsGenericImport(const ActorIOArgumentImporterSpec::FImportCase& InCase);
+
+END_DEFINE_SPEC(FActorIOArgumentImporterSpec)
+
+void FActorIOArgumentImporterSpec::Define()
+{
+	using namespace ActorIOArgumentImporterSpec;
+
+	Describe("TryImport", [this]()
+	{
+		// Arguments in the form that actions usually pass them, followed by edge cases around the limits of the specialized importers.
+		const FImportCase Cases[] =
+		{
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, BoolParam), TEXT("true") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, BoolParam), TEXT("False") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, IntParam), TEXT("-42") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, IntParam), TEXT("2147483647") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, IntParam), TEXT("-2147483648") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, IntParam), TEXT("2147483648") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, IntParam), TEXT("4294967296") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, IntParam), TEXT("-99999999999") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, FloatParam), TEXT("1.5") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, FloatParam), TEXT(".5") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, FloatParam), TEXT("1e3") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, DoubleParam), TEXT("0.25") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, DoubleParam), TEXT("-2.5E-3") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, NameParam), TEXT("Open") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, NameParam), TEXT("\"Open Door\"") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, StringParam), TEXT("Hello World") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, EnumParam), TEXT("Second") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, EnumParam), TEXT("EActorIOImporterTestEnum::Third") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, ObjectParam), TEXT("/Script/CoreUObject.Object") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, VectorParam), TEXT("(X=1.0,Y=-2.5,Z=300.0)") },
+			{ GET_MEMBER_NAME_CHECKED(FActorIOImporterTestParams, ColorParam), TEXT("(R=1.0,G=0.5,B=0.25,A=1.0)") },
+		};
+
+		for (const FImportCase& Case : Cases)
+		{
+			It(FString::Printf(TEXT("should import '%s' into %s the same way as the generic importer"), *Case.Argument, *Case.PropertyName.ToString()), [this, Case]()
+			{
+				TestSameAsGenericImport(Case);
+			});
+		}
+	});
+}
+
+void FActorIOArgumentImporterSpec::TestSameAsGenericImport(const ActorIOArgumentImporterSpec::FImportCase& InCase)
+{
+	const FProperty* Property = FActorIOImporterTestParams::StaticStruct()->FindPropertyByName(InCase.PropertyName);
+	if (!TestNotNull(TEXT("Property"), Property))
+	{
+		return;
+	}
+
+	FActorIOImporterTestParams GenericParams;
+	const bool bGenericImported = Property->ImportText_InContainer(*InCase.Argument, &GenericParams, nullptr, PPF_None) != nullptr;
+
+	// Same as the I/O subsystem, which uses the generic importer for anything the specialized importer doesn't take.
+	// The specialized string importer moves the argument, so it gets its own copy.
+	FString Argument = InCase.Argument;
+	FActorIOImporterTestParams FastParams;
+	const bool bFastImported = FActorIOArgumentImporter::TryImport(Property, Argument, &FastParams)
+		|| Property->ImportText_InContainer(*InCase.Argument, &FastParams, nullptr, PPF_None) != nullptr;
+
+	TestEqual(TEXT("Imported"), bFastImported, bGenericImported);
+	TestTrue(TEXT("Same value as the generic importer"), Property->Identical_InContainer(&GenericParams, &FastParams));
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
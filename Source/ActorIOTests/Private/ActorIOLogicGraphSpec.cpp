@@ -0,0 +1,131 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "Misc/AutomationTest.h"
+#include "ActorIOTestWorld.h"
+#include "ActorIOComponent.h"
+#include "ActorIOAction.h"
+#include "ActorIOSettings.h"
+#include "ActorIOSubsystemBase.h"
+#include "LogicActors/LogicRelay.h"
+#include "LogicActors/LogicCounter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ActorIOLogicGraphSpec
+{
+	const FName OnTrigger = TEXT("ALogicRelay::OnTrigger");
+	const FName Trigger = TEXT("ALogicRelay::Trigger");
+	const FName Add = TEXT("ALogicCounter::Add");
+}
+
+BEGIN_DEFINE_SPEC(FActorIOLogicGraphSpec, "ActorIO.LogicGraph", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+	TUniquePtr<FActorIOTestWorld> TestWorld;
+
+	/** Collapse relay chains setting before the test. */
+	bool bCollapseRelayChainsBefore;
+
+END_DEFINE_SPEC(FActorIOLogicGraphSpec)
+
+void FActorIOLogicGraphSpec::Define()
+{
+	using namespace ActorIOLogicGraphSpec;
+
+	BeforeEach([this]()
+	{
+		TestWorld = MakeUnique<FActorIOTestWorld>();
+
+		UActorIOSettings* IOSettings = GetMutableDefault<UActorIOSettings>();
+		bCollapseRelayChainsBefore = IOSettings->bCollapseRelayChains;
+		IOSettings->bCollapseRelayChains = true;
+	});
+
+	AfterEach([this]()
+	{
+		GetMutableDefault<UActorIOSettings>()->bCollapseRelayChains = bCollapseRelayChainsBefore;
+		TestWorld.Reset();
+	});
+
+	Describe("Relay chains", [this]()
+	{
+		It("should collapse a chain of relays into direct triggers", [this]()
+		{
+			ALogicRelay* FirstRelay = TestWorld->SpawnActor<ALogicRelay>();
+			ALogicRelay* SecondRelay = TestWorld->SpawnActor<ALogicRelay>();
+			ALogicRelay* LastRelay = TestWorld->SpawnActor<ALogicRelay>();
+			ALogicCounter* Counter = TestWorld->SpawnActor<ALogicCounter>();
+
+			UActorIOComponent* FirstIO = TestWorld->CreateIOComponent(FirstRelay);
+			UActorIOComponent* SecondIO = TestWorld->CreateIOComponent(SecondRelay);
+			UActorIOComponent* LastIO = TestWorld->CreateIOComponent(LastRelay);
+
+			UActorIOAction* FirstAction = TestWorld->AddAction(FirstIO, OnTrigger, SecondRelay, Trigger);
+			UActorIOAction* SecondAction = TestWorld->AddAction(SecondIO, OnTrigger, LastRelay, Trigger);
+			UActorIOAction* LastAction = TestWorld->AddAction(LastIO, OnTrigger, Counter, Add, TEXT("1"));
+
+			TestWorld->RegisterIOComponent(FirstIO);
+			TestWorld->RegisterIOComponent(SecondIO);
+			TestWorld->RegisterIOComponent(LastIO);
+
+			// Compile the graphs like the cook would, and check that every hop of the chain was compiled as a direct trigger.
+			const TPair<UActorIOComponent*, bool> ExpectedHops[] =
+			{
+				{ FirstIO, true },
+				{ SecondIO, true },
+				{ LastIO, false }
+			};
+
+			for (const TPair<UActorIOComponent*, bool>& Hop : ExpectedHops)
+			{
+				Hop.Key->CompileLogicGraph();
+
+				const FActorIOLogicGraph& LogicGraph = Hop.Key->GetLogicGraph();
+				const FString Context = Hop.Key->GetOwner()->GetName();
+				if (!TestTrue(FString::Printf(TEXT("%s graph compiled"), *Context), LogicGraph.IsCompiled()))
+				{
+					return;
+				}
+
+				TestEqual(FString::Printf(TEXT("%s graph events"), *Context), LogicGraph.Events.Num(), 1);
+				TestEqual(FString::Printf(TEXT("%s runtime bound actions"), *Context), LogicGraph.RuntimeBoundActions.Num(), 0);
+				TestEqual(FString::Printf(TEXT("%s direct relay trigger"), *Context), LogicGraph.Actions[0].bDirectRelayTrigger, Hop.Value);
+			}
+
+			// Apply the compiled flags like a cooked level would.
+			FirstAction->SetDirectRelayTrigger(FirstIO->GetLogicGraph().Actions[0].bDirectRelayTrigger);
+			SecondAction->SetDirectRelayTrigger(SecondIO->GetLogicGraph().Actions[0].bDirectRelayTrigger);
+			LastAction->SetDirectRelayTrigger(LastIO->GetLogicGraph().Actions[0].bDirectRelayTrigger);
+
+			// Collapsed hops are logged by the subsystem, not as a regular message.
+			const bool bLogFinalCommandBefore = CVarLogIOActionFinalCommand.GetValueOnGameThread();
+			CVarLogIOActionFinalCommand->Set(true, ECVF_SetByCode);
+			AddExpectedMessage(TEXT(", Direct)"), ELogVerbosity::Log, EAutomationExpectedMessageFlags::Contains, 2);
+
+			FirstRelay->Trigger();
+			CVarLogIOActionFinalCommand->Set(bLogFinalCommandBefore, ECVF_SetByCode);
+
+			TestEqual(TEXT("Counter value"), Counter->GetValue(), 1);
+			TestEqual(TEXT("Pending messages"), TestWorld->GetSubsystem()->GetNumPendingMessages(), 0);
+		});
+
+		It("should not collapse relays with a delay", [this]()
+		{
+			ALogicRelay* FirstRelay = TestWorld->SpawnActor<ALogicRelay>();
+			ALogicRelay* SecondRelay = TestWorld->SpawnActor<ALogicRelay>();
+
+			UActorIOComponent* FirstIO = TestWorld->CreateIOComponent(FirstRelay);
+			TestWorld->AddAction(FirstIO, OnTrigger, SecondRelay, Trigger, FString(), 1.0f);
+			TestWorld->RegisterIOComponent(FirstIO);
+
+			FirstIO->CompileLogicGraph();
+
+			const FActorIOLogicGraph& LogicGraph = FirstIO->GetLogicGraph();
+			if (TestTrue(TEXT("Graph compiled"), LogicGraph.IsCompiled()))
+			{
+				TestFalse(TEXT("Direct relay trigger"), LogicGraph.Actions[0].bDirectRelayTrigger);
+			}
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
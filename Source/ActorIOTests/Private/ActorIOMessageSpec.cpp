@@ -0,0 +1,488 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "Misc/AutomationTest.h"
+#include "ActorIOTestWorld.h"
+#include "ActorIOComponent.h"
+#include "ActorIOAction.h"
+#include "ActorIOSubsystemBase.h"
+#include "LogicActors/LogicCounter.h"
+#include "Engine/PointLight.h"
+#include "Components/LightComponent.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Serialization/Formatters/BinaryArchiveFormatter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ActorIOMessageSpec
+{
+	const FName OnValueChanged = TEXT("ALogicCounter::OnValueChanged");
+	const FName Add = TEXT("ALogicCounter::Add");
+	const FName SetValue = TEXT("ALogicCounter::SetValue");
+	const FName SetLightIntensity = TEXT("ALight::SetLightIntensity");
+}
+
+BEGIN_DEFINE_SPEC(FActorIOMessageSpec, "ActorIO.Messages", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+	TUniquePtr<FActorIOTestWorld> TestWorld;
+
+	/** Counter that fires the events. */
+	ALogicCounter* Sender;
+
+	/** Counter that receives the messages. */
+	ALogicCounter* Receiver;
+
+	/** I/O component of the sender. */
+	UActorIOComponent* SenderIO;
+
+	/** Save or load the I/O component of the sender the same way save games do. */
+	void SerializeSenderIO(FArchive& Ar);
+
+	/** Action of the scaling specs whose messages are delivered first. */
+	UActorIOAction* ShortAction;
+
+	/** Fire the event of the sender until the given number of messages is pending. */
+	void QueueMessages(int32 NumMessages);
+
+	/** @return Seconds elapsed while running the given operation. */
+	static double TimeOperation(TFunctionRef<void()> Operation);
+
+	/**
+	 * Measure the given operation with 1000 to 100000 pending messages, and test that the cost per message stays flat.
+	 * @param MeasureCost Queues the given number of messages, runs the operation, and returns the seconds it took.
+	 */
+	void TestFlatCost(const FString& What, TFunctionRef<double(int32)> MeasureCost);
+
+END_DEFINE_SPEC(FActorIOMessageSpec)
+
+void FActorIOMessageSpec::Define()
+{
+	using namespace ActorIOMessageSpec;
+
+	BeforeEach([this]()
+	{
+		TestWorld = MakeUnique<FActorIOTestWorld>();
+		Sender = TestWorld->SpawnActor<ALogicCounter>();
+		Receiver = TestWorld->SpawnActor<ALogicCounter>();
+		SenderIO = TestWorld->CreateIOComponent(Sender);
+	});
+
+	AfterEach([this]()
+	{
+		TestWorld.Reset();
+		Sender = nullptr;
+		Receiver = nullptr;
+		SenderIO = nullptr;
+		ShortAction = nullptr;
+	});
+
+	Describe("Delivery", [this]()
+	{
+		It("should deliver messages without delay immediately", [this]()
+		{
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("2"));
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+			TestEqual(TEXT("Receiver value"), Receiver->GetValue(), 2);
+			TestEqual(TEXT("Pending messages"), TestWorld->GetSubsystem()->GetNumPendingMessages(), 0);
+		});
+
+		It("should not deliver delayed messages before their delay has elapsed", [this]()
+		{
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"), 0.5f);
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+			TestEqual(TEXT("Pending messages after firing"), TestWorld->GetSubsystem()->GetNumPendingMessages(), 1);
+
+			TestWorld->Tick(0.25f);
+			TestEqual(TEXT("Receiver value before delay"), Receiver->GetValue(), 0);
+			TestEqual(TEXT("Pending messages before delay"), TestWorld->GetSubsystem()->GetNumPendingMessages(), 1);
+
+			TestWorld->Tick(0.3f);
+			TestEqual(TEXT("Receiver value after delay"), Receiver->GetValue(), 1);
+			TestEqual(TEXT("Pending messages after delay"), TestWorld->GetSubsystem()->GetNumPendingMessages(), 0);
+		});
+
+		It("should deliver messages that are due in the same frame in the order they were queued", [this]()
+		{
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, SetValue, TEXT("5"), 0.1f);
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"), 0.2f);
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+			TestWorld->Tick(0.5f);
+
+			// SetValue then Add gives 6. The other way around would give 5.
+			TestEqual(TEXT("Receiver value"), Receiver->GetValue(), 6);
+		});
+
+		It("should keep messages pending while the level is inactive", [this]()
+		{
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"));
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+			ULevel* Level = TestWorld->GetWorld()->PersistentLevel;
+			IOSubsystem->DeactivateLevel(Level, false);
+
+			Sender->Add(1);
+			TestWorld->Tick(0.1f);
+			TestEqual(TEXT("Receiver value while inactive"), Receiver->GetValue(), 0);
+			TestEqual(TEXT("Pending messages while inactive"), IOSubsystem->GetNumPendingMessages(), 1);
+
+			IOSubsystem->ActivateLevel(Level);
+			TestWorld->Tick(0.1f);
+			TestEqual(TEXT("Receiver value after activation"), Receiver->GetValue(), 1);
+			TestEqual(TEXT("Pending messages after activation"), IOSubsystem->GetNumPendingMessages(), 0);
+		});
+	});
+
+	Describe("RemovePendingMessages", [this]()
+	{
+		It("should remove the pending messages of the given action only", [this]()
+		{
+			UActorIOAction* RemovedAction = TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"), 1.0f);
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("10"), 1.0f);
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+			Sender->Add(1);
+
+			UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+			TestEqual(TEXT("Pending messages before removal"), IOSubsystem->GetNumPendingMessages(), 4);
+
+			IOSubsystem->RemovePendingMessages(RemovedAction);
+			TestEqual(TEXT("Pending messages after removal"), IOSubsystem->GetNumPendingMessages(), 2);
+
+			TestWorld->Tick(2.0f);
+			TestEqual(TEXT("Receiver value"), Receiver->GetValue(), 20);
+		});
+
+		It("should remove the pending messages of the given level", [this]()
+		{
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"), 1.0f);
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+
+			UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+			IOSubsystem->RemovePendingMessages(TestWorld->GetWorld()->PersistentLevel);
+			TestEqual(TEXT("Pending messages"), IOSubsystem->GetNumPendingMessages(), 0);
+		});
+	});
+
+	Describe("Arguments", [this]()
+	{
+		It("should resolve named arguments of the caller", [this]()
+		{
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, SetValue, TEXT("$Value"));
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->SetValue(7);
+			TestEqual(TEXT("Receiver value"), Receiver->GetValue(), 7);
+		});
+
+		It("should execute functions on the subobject of the target", [this]()
+		{
+			APointLight* Light = TestWorld->SpawnActor<APointLight>();
+			TestWorld->AddAction(SenderIO, OnValueChanged, Light, SetLightIntensity, TEXT("1234"));
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+			TestEqual(TEXT("Light intensity"), Light->GetLightComponent()->Intensity, 1234.0f);
+			TestEqual(TEXT("Target subobject"), TestWorld->GetSubsystem()->FindTargetSubobject(Light, TEXT("LightComponent0")), static_cast<UObject*>(Light->GetLightComponent()));
+		});
+	});
+
+	Describe("Save data", [this]()
+	{
+		It("should restore the executed state of execute once actions", [this]()
+		{
+			UActorIOAction* Action = TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"), 0.5f);
+			Action->bExecuteOnlyOnce = true;
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+			Sender->Add(1);
+			TestWorld->Tick(1.0f);
+			TestEqual(TEXT("Receiver value"), Receiver->GetValue(), 1);
+
+			UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+			TArray<uint8> RawData;
+			IOSubsystem->SerializeWorldToRawData(RawData);
+
+			// Pretend that the world was reloaded, and the action has not been executed yet.
+			Action->RestoreExecutedState(false);
+			TestFalse(TEXT("Executed before restore"), Action->GetWasExecuted());
+
+			// The event fires before the save is restored, e.g. on begin play.
+			Sender->Add(1);
+			TestEqual(TEXT("Pending messages before restore"), IOSubsystem->GetNumPendingMessages(), 1);
+
+			TestTrue(TEXT("Restored"), IOSubsystem->RestoreWorldFromRawData(RawData));
+			TestTrue(TEXT("Executed after restore"), Action->GetWasExecuted());
+			TestEqual(TEXT("Pending messages after restore"), IOSubsystem->GetNumPendingMessages(), 0);
+
+			Sender->Add(1);
+			TestWorld->Tick(1.0f);
+			TestEqual(TEXT("Receiver value after restore"), Receiver->GetValue(), 1);
+		});
+
+		It("should recall the pending messages of execute once actions that were executed before the save was restored", [this]()
+		{
+			UActorIOAction* Action = TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"), 0.5f);
+			Action->bExecuteOnlyOnce = true;
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+			TestWorld->Tick(1.0f);
+			TestEqual(TEXT("Receiver value"), Receiver->GetValue(), 1);
+
+			TArray<uint8> RawData;
+			FMemoryWriter Writer = FMemoryWriter(RawData);
+			SerializeSenderIO(Writer);
+
+			// Pretend that the world was reloaded, and the event fired before the save was restored.
+			Action->RestoreExecutedState(false);
+			Sender->Add(1);
+
+			UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+			TestEqual(TEXT("Pending messages before restore"), IOSubsystem->GetNumPendingMessages(), 1);
+
+			// Only the component is restored here, so the pending message can only be gone if the action recalled it.
+			FMemoryReader Reader = FMemoryReader(RawData);
+			SerializeSenderIO(Reader);
+			TestTrue(TEXT("Executed after restore"), Action->GetWasExecuted());
+			TestEqual(TEXT("Pending messages after restore"), IOSubsystem->GetNumPendingMessages(), 0);
+
+			TestWorld->Tick(1.0f);
+			TestEqual(TEXT("Receiver value after restore"), Receiver->GetValue(), 1);
+		});
+
+		It("should restore executed states by action id if the action layout has changed", [this]()
+		{
+			UActorIOAction* RemovedAction = TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("10"));
+			UActorIOAction* Action = TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"));
+			Action->bExecuteOnlyOnce = true;
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+
+			UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+			TArray<uint8> RawData;
+			IOSubsystem->SerializeWorldToRawData(RawData);
+
+			// Pretend that the level was modified after the save was made.
+			SenderIO->RemoveAction(RemovedAction);
+			Action->RestoreExecutedState(false);
+
+			TestTrue(TEXT("Restored"), IOSubsystem->RestoreWorldFromRawData(RawData));
+			TestTrue(TEXT("Executed after restore"), Action->GetWasExecuted());
+		});
+
+		It("should restore saved executed states of the component by action id if the action layout has changed", [this]()
+		{
+			UActorIOAction* RemovedAction = TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("10"));
+			UActorIOAction* Action = TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"));
+			Action->bExecuteOnlyOnce = true;
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+
+			TArray<uint8> RawData;
+			FMemoryWriter Writer = FMemoryWriter(RawData);
+			SerializeSenderIO(Writer);
+
+			// Pretend that the level was modified after the save was made.
+			SenderIO->RemoveAction(RemovedAction);
+			Action->RestoreExecutedState(false);
+
+			FMemoryReader Reader = FMemoryReader(RawData);
+			SerializeSenderIO(Reader);
+			TestFalse(TEXT("Archive error"), Reader.IsError());
+			TestTrue(TEXT("Executed after restore"), Action->GetWasExecuted());
+		});
+
+		It("should replace the pending messages of restored levels", [this]()
+		{
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"), 1.0f);
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+
+			UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+			TArray<uint8> RawData;
+			IOSubsystem->SerializeWorldToRawData(RawData);
+
+			IOSubsystem->RestoreWorldFromRawData(RawData);
+			IOSubsystem->RestoreWorldFromRawData(RawData);
+			TestEqual(TEXT("Pending messages"), IOSubsystem->GetNumPendingMessages(), 1);
+
+			TestWorld->Tick(2.0f);
+			TestEqual(TEXT("Receiver value"), Receiver->GetValue(), 1);
+		});
+
+		It("should replace the pending messages when restoring the subsystem from raw data", [this]()
+		{
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"), 1.0f);
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("10"), 1.0f);
+			TestWorld->RegisterIOComponent(SenderIO);
+
+			Sender->Add(1);
+
+			UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+			TArray<uint8> RawData;
+			IOSubsystem->SerializeToRawData(RawData);
+
+			IOSubsystem->RestoreFromRawData(RawData);
+			IOSubsystem->RestoreFromRawData(RawData);
+			TestEqual(TEXT("Pending messages"), IOSubsystem->GetNumPendingMessages(), 2);
+
+			TestWorld->Tick(2.0f);
+			TestEqual(TEXT("Receiver value"), Receiver->GetValue(), 11);
+		});
+	});
+
+	Describe("Scaling", [this]()
+	{
+		// Every event queues two messages: one from the short action, followed by one from the long action.
+		// So every other pending message belongs to the same action, which is the worst case for removing messages one by one.
+		BeforeEach([this]()
+		{
+			ShortAction = TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"), 0.5f);
+			TestWorld->AddAction(SenderIO, OnValueChanged, Receiver, Add, TEXT("1"), 2.0f);
+			TestWorld->RegisterIOComponent(SenderIO);
+		});
+
+		It("should deliver pending messages at a flat cost per message", [this]()
+		{
+			TestFlatCost(TEXT("Delivering all messages"), [this](int32 NumMessages)
+			{
+				const int32 ValueBefore = Receiver->GetValue();
+				QueueMessages(NumMessages);
+
+				const double Cost = TimeOperation([this]() { TestWorld->Tick(3.0f); });
+				TestEqual(TEXT("Delivered messages"), Receiver->GetValue() - ValueBefore, NumMessages);
+				return Cost;
+			});
+		});
+
+		It("should deliver interleaved pending messages at a flat cost per message", [this]()
+		{
+			TestFlatCost(TEXT("Delivering every other message"), [this](int32 NumMessages)
+			{
+				const int32 ValueBefore = Receiver->GetValue();
+				QueueMessages(NumMessages);
+
+				const double Cost = TimeOperation([this]() { TestWorld->Tick(1.0f); });
+				TestEqual(TEXT("Delivered messages"), Receiver->GetValue() - ValueBefore, NumMessages / 2);
+				TestEqual(TEXT("Remaining messages"), TestWorld->GetSubsystem()->GetNumPendingMessages(), NumMessages / 2);
+
+				TestWorld->GetSubsystem()->RemovePendingMessages(TestWorld->GetWorld()->PersistentLevel);
+				return Cost;
+			});
+		});
+
+		It("should remove the pending messages of an action at a flat cost per message", [this]()
+		{
+			TestFlatCost(TEXT("Removing messages by action"), [this](int32 NumMessages)
+			{
+				QueueMessages(NumMessages);
+
+				UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+				const double Cost = TimeOperation([this, IOSubsystem]() { IOSubsystem->RemovePendingMessages(ShortAction); });
+				TestEqual(TEXT("Remaining messages"), IOSubsystem->GetNumPendingMessages(), NumMessages / 2);
+
+				IOSubsystem->RemovePendingMessages(TestWorld->GetWorld()->PersistentLevel);
+				return Cost;
+			});
+		});
+
+		It("should remove the pending messages of a level at a flat cost per message", [this]()
+		{
+			TestFlatCost(TEXT("Removing messages by level"), [this](int32 NumMessages)
+			{
+				QueueMessages(NumMessages);
+
+				UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+				const double Cost = TimeOperation([this, IOSubsystem]() { IOSubsystem->RemovePendingMessages(TestWorld->GetWorld()->PersistentLevel); });
+				TestEqual(TEXT("Remaining messages"), IOSubsystem->GetNumPendingMessages(), 0);
+				return Cost;
+			});
+		});
+
+		It("should keep the senders of pending messages when restoring the subsystem from raw data", [this]()
+		{
+			QueueMessages(10000);
+
+			UActorIOSubsystemBase* IOSubsystem = TestWorld->GetSubsystem();
+			TArray<uint8> RawData;
+			IOSubsystem->SerializeToRawData(RawData);
+			IOSubsystem->RestoreFromRawData(RawData);
+			TestEqual(TEXT("Pending messages after restore"), IOSubsystem->GetNumPendingMessages(), 10000);
+
+			IOSubsystem->RemovePendingMessages(ShortAction);
+			TestEqual(TEXT("Pending messages after removal"), IOSubsystem->GetNumPendingMessages(), 5000);
+
+			TestWorld->Tick(3.0f);
+			TestEqual(TEXT("Receiver value"), Receiver->GetValue(), 5000);
+		});
+	});
+}
+
+void FActorIOMessageSpec::SerializeSenderIO(FArchive& Ar)
+{
+	FObjectAndNameAsStringProxyArchive ProxyArchive = FObjectAndNameAsStringProxyArchive(Ar, false);
+	ProxyArchive.ArIsSaveGame = true;
+
+	FBinaryArchiveFormatter Formatter = FBinaryArchiveFormatter(ProxyArchive);
+	FStructuredArchive StructuredArchive = FStructuredArchive(Formatter);
+
+	FStructuredArchive::FSlot RootSlot = StructuredArchive.Open();
+	SenderIO->Serialize(RootSlot.EnterRecord());
+}
+
+void FActorIOMessageSpec::QueueMessages(int32 NumMessages)
+{
+	check(NumMessages % 2 == 0);
+	for (int32 EventIdx = 0; EventIdx != NumMessages / 2; ++EventIdx)
+	{
+		Sender->Add(1);
+	}
+
+	TestEqual(TEXT("Pending messages"), TestWorld->GetSubsystem()->GetNumPendingMessages(), NumMessages);
+}
+
+double FActorIOMessageSpec::TimeOperation(TFunctionRef<void()> Operation)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	Operation();
+	return FPlatformTime::Seconds() - StartTime;
+}
+
+void FActorIOMessageSpec::TestFlatCost(const FString& What, TFunctionRef<double(int32)> MeasureCost)
+{
+	// Warm up, so that the first measurement doesn't include one time costs.
+	MeasureCost(100);
+
+	const int32 MessageCounts[] = { 1000, 10000, 100000 };
+	const double SmallCost = MeasureCost(MessageCounts[0]) / MessageCounts[0];
+
+	// Generous tolerance, since timings are noisy on build machines.
+	// Quadratic behavior would be a factor of 10 at 10000 messages, and a factor of 100 at 100000 messages.
+	const double Tolerance = 4.0;
+
+	for (int32 CountIdx = 1; CountIdx != UE_ARRAY_COUNT(MessageCounts); ++CountIdx)
+	{
+		const int32 NumMessages = MessageCounts[CountIdx];
+		const double Cost = MeasureCost(NumMessages) / NumMessages;
+		TestTrue(FString::Printf(TEXT("%s: Per-message cost at %d messages (%.3f us) is within %.1fx of the cost at %d messages (%.3f us)"), *What, NumMessages, Cost * 1e6, Tolerance, MessageCounts[0], SmallCost * 1e6),
+			Cost <= SmallCost * Tolerance);
+	}
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,52 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActorIOTestTypes.generated.h"
+
+/** Enum parameter of the argument importer specs. */
+UENUM()
+enum class EActorIOImporterTestEnum : uint8
+{
+	First,
+	Second,
+	Third
+};
+
+/** Parameters of the argument importer specs. One property for each parameter type that has a specialized importer. */
+USTRUCT()
+struct FActorIOImporterTestParams
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	bool BoolParam = false;
+
+	UPROPERTY()
+	int32 IntParam = 0;
+
+	UPROPERTY()
+	float FloatParam = 0.0f;
+
+	UPROPERTY()
+	double DoubleParam = 0.0;
+
+	UPROPERTY()
+	FName NameParam;
+
+	UPROPERTY()
+	FString StringParam;
+
+	UPROPERTY()
+	EActorIOImporterTestEnum EnumParam = EActorIOImporterTestEnum::First;
+
+	UPROPERTY()
+	TObjectPtr<UObject> ObjectParam;
+
+	UPROPERTY()
+	FVector VectorParam = FVector::ZeroVector;
+
+	UPROPERTY()
+	FLinearColor ColorParam = FLinearColor::Black;
+};
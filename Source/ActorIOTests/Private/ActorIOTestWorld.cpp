@@ -0,0 +1,79 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "ActorIOTestWorld.h"
+#include "ActorIOComponent.h"
+#include "ActorIOAction.h"
+#include "ActorIOSubsystemBase.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectGlobals.h"
+
+FActorIOTestWorld::FActorIOTestWorld()
+{
+	World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("ActorIOTestWorld"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	// No game mode is needed. We only want the world to begin play so that actors and components are fully initialized.
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	// Messages are only delivered in active levels, regardless of the level activation method.
+	UActorIOSubsystemBase* IOSubsystem = GetSubsystem();
+	check(IOSubsystem);
+	IOSubsystem->ActivateLevel(World->PersistentLevel);
+}
+
+FActorIOTestWorld::~FActorIOTestWorld()
+{
+	World->DestroyWorld(false);
+	GEngine->DestroyWorldContext(World);
+	World = nullptr;
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+UActorIOSubsystemBase* FActorIOTestWorld::GetSubsystem() const
+{
+	return UActorIOSubsystemBase::Get(World);
+}
+
+UActorIOComponent* FActorIOTestWorld::CreateIOComponent(AActor* InOwner)
+{
+	check(InOwner);
+	return NewObject<UActorIOComponent>(InOwner, TEXT("ActorIOComponent"));
+}
+
+void FActorIOTestWorld::RegisterIOComponent(UActorIOComponent* InComponent)
+{
+	check(InComponent);
+
+	AActor* Owner = InComponent->GetOwner();
+	Owner->AddInstanceComponent(InComponent);
+	InComponent->RegisterComponent();
+}
+
+UActorIOAction* FActorIOTestWorld::AddAction(UActorIOComponent* InComponent, FName InEventId, AActor* InTarget, FName InFunctionId, const FString& InArguments, float InDelay)
+{
+	check(InComponent);
+
+	UActorIOAction* NewAction = InComponent->CreateNewAction();
+	NewAction->EventId = InEventId;
+	NewAction->TargetActor = InTarget;
+	NewAction->FunctionId = InFunctionId;
+	NewAction->FunctionArguments = InArguments;
+	NewAction->Delay = InDelay;
+	return NewAction;
+}
+
+void FActorIOTestWorld::Tick(float DeltaTime)
+{
+	UActorIOSubsystemBase* IOSubsystem = GetSubsystem();
+	if (IOSubsystem && IOSubsystem->IsTickable())
+	{
+		IOSubsystem->Tick(DeltaTime);
+	}
+
+	GFrameCounter++;
+}
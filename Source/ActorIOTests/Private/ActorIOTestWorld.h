@@ -0,0 +1,63 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+
+class AActor;
+class UActorIOComponent;
+class UActorIOAction;
+class UActorIOSubsystemBase;
+
+/**
+ * Game world for automation specs, created in memory with its persistent level already active.
+ * Actors are spawned into the persistent level, and the I/O subsystem is ticked manually.
+ * The world is destroyed when the object goes out of scope.
+ */
+class FActorIOTestWorld
+{
+public:
+
+	/** Create the world and begin play. */
+	FActorIOTestWorld();
+
+	/** Destroy the world. */
+	~FActorIOTestWorld();
+
+	FActorIOTestWorld(const FActorIOTestWorld&) = delete;
+	FActorIOTestWorld& operator=(const FActorIOTestWorld&) = delete;
+
+	/** @return The world. */
+	UWorld* GetWorld() const { return World; }
+
+	/** @return The I/O subsystem of the world. */
+	UActorIOSubsystemBase* GetSubsystem() const;
+
+	/** Spawn an actor in the persistent level. */
+	template<typename T>
+	T* SpawnActor()
+	{
+		return World->SpawnActor<T>();
+	}
+
+	/**
+	 * Create an I/O component for the given actor.
+	 * The component is not registered, so that actions can be added before they are bound. @see RegisterIOComponent
+	 */
+	UActorIOComponent* CreateIOComponent(AActor* InOwner);
+
+	/** Register the component, which binds its actions. */
+	void RegisterIOComponent(UActorIOComponent* InComponent);
+
+	/** Add a new action to an I/O component. */
+	UActorIOAction* AddAction(UActorIOComponent* InComponent, FName InEventId, AActor* InTarget, FName InFunctionId, const FString& InArguments = FString(), float InDelay = 0.0f);
+
+	/** Tick the I/O subsystem, and advance the frame counter. */
+	void Tick(float DeltaTime);
+
+private:
+
+	/** The world. Kept alive by its world context. */
+	UWorld* World;
+};
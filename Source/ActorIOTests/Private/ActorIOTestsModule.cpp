@@ -0,0 +1,6 @@
+// Copyright 2024-2026 Horizon Games and all contributors at https://github.com/HorizonGamesRoland/ActorIO/graphs/contributors
+
+#include "Modules/ModuleManager.h"
+
+// Automation specs of the Actor I/O plugin. Run them from the Session Frontend, or with "Automation RunTests ActorIO".
+IMPLEMENT_MODULE(FDefaultModuleImpl, ActorIOTests)